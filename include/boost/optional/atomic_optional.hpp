@@ -0,0 +1,220 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_ATOMIC_OPTIONAL_19OCT2026_HPP
+#define BOOST_OPTIONAL_ATOMIC_OPTIONAL_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <boost/core/launder.hpp>
+#include <boost/optional/optional.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace boost {
+
+/** Customization point telling `atomic_optional<T>` that `T` has a value
+    that is never used, whose bit pattern can then represent the empty state,
+    so that no separate flag is needed. A specialization with `value == true`
+    provides `static T get() noexcept`, returning that value.
+ */
+template <class T>
+struct atomic_optional_niche : ::std::false_type {};
+
+} // namespace boost
+
+
+namespace boost { namespace optional_detail {
+
+template < ::std::size_t Size>
+struct atomic_word_of_size
+{
+  typedef typename ::std::conditional<(Size <= 1), ::std::uint8_t,
+          typename ::std::conditional<(Size <= 2), ::std::uint16_t,
+          typename ::std::conditional<(Size <= 4), ::std::uint32_t, ::std::uint64_t>::type>::type>::type type;
+};
+
+// Copies the value of type `T` out of the first bytes of `w`;
+// `T` need not be default-constructible.
+template <class T, class W>
+T atomic_value_of(W const& w) noexcept
+{
+  alignas(T) unsigned char buf[sizeof(T)];
+  ::std::memcpy(buf, &w, sizeof(T));
+  return *::boost::core::launder(reinterpret_cast<T*>(buf));
+}
+
+// The encoding of `optional<T>` in an unsigned integer: the bytes of the
+// value followed by a byte that is 1 if the value is present. The empty
+// state is all zeros.
+template <class T, bool HasNiche = atomic_optional_niche<T>::value>
+struct atomic_optional_codec
+{
+  static_assert(sizeof(T) < 8, "atomic_optional<T> without a niche requires sizeof(T) < 8");
+  typedef typename atomic_word_of_size<sizeof(T) + 1>::type word_type;
+
+  static word_type empty() noexcept { return 0; }
+
+  static word_type encode(T const& v) noexcept
+  {
+    word_type w = 0;
+    unsigned char const flag = 1;
+    ::std::memcpy(&w, &v, sizeof(T));
+    ::std::memcpy(reinterpret_cast<unsigned char*>(&w) + sizeof(T), &flag, 1);
+    return w;
+  }
+
+  static optional<T> decode(word_type w) noexcept
+  {
+    if (w == 0)
+      return none;
+    return atomic_value_of<T>(w);
+  }
+};
+
+// The encoding of `optional<T>` for a `T` with a niche: the bytes of the value,
+// with the bytes of the niche value representing the empty state.
+template <class T>
+struct atomic_optional_codec<T, true>
+{
+  static_assert(sizeof(T) <= 8, "atomic_optional<T> requires sizeof(T) <= 8");
+  typedef typename atomic_word_of_size<sizeof(T)>::type word_type;
+
+  static word_type empty() noexcept { return encode(atomic_optional_niche<T>::get()); }
+
+  static word_type encode(T const& v) noexcept
+  {
+    word_type w = 0;
+    ::std::memcpy(&w, &v, sizeof(T));
+    return w;
+  }
+
+  static optional<T> decode(word_type w) noexcept
+  {
+    if (w == empty())
+      return none;
+    return atomic_value_of<T>(w);
+  }
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** An atomic `optional<T>`, for trivially copyable `T`s small enough that
+    the value and the presence flag fit together in one machine word of up
+    to 8 bytes: `T`s of less than 8 bytes, or of 8 bytes if they have a niche
+    (see `atomic_optional_niche`). All the operations are single atomic
+    instructions on the word: `load()`, `store()` and `exchange()` are
+    wait-free where the hardware provides them, the compare-and-exchange
+    operations are lock-free.
+
+    As with `std::atomic`, comparisons are done on the object representations,
+    so `T` should have no padding bytes.
+ */
+template <class T>
+class atomic_optional
+{
+  static_assert(::std::is_trivially_copyable<T>::value, "atomic_optional<T> requires a trivially copyable T");
+
+  typedef optional_detail::atomic_optional_codec<T> codec;
+  typedef typename codec::word_type word_type;
+
+public:
+  typedef T value_type;
+
+  atomic_optional() noexcept : word_(codec::empty()) {}
+  atomic_optional(none_t) noexcept : word_(codec::empty()) {}
+  atomic_optional(T const& v) noexcept : word_(codec::encode(v)) {}
+
+  atomic_optional(atomic_optional const&) = delete;
+  atomic_optional& operator=(atomic_optional const&) = delete;
+
+  bool is_lock_free() const noexcept { return word_.is_lock_free(); }
+
+  optional<T> load(::std::memory_order order = ::std::memory_order_seq_cst) const noexcept
+  {
+    return codec::decode(word_.load(order));
+  }
+
+  bool has_value(::std::memory_order order = ::std::memory_order_seq_cst) const noexcept
+  {
+    return word_.load(order) != codec::empty();
+  }
+
+  void store(optional<T> const& v, ::std::memory_order order = ::std::memory_order_seq_cst) noexcept
+  {
+    word_.store(encode(v), order);
+  }
+
+  void reset(::std::memory_order order = ::std::memory_order_seq_cst) noexcept
+  {
+    word_.store(codec::empty(), order);
+  }
+
+  // Stores `v` and returns the previous value.
+  optional<T> exchange(optional<T> const& v, ::std::memory_order order = ::std::memory_order_seq_cst) noexcept
+  {
+    return codec::decode(word_.exchange(encode(v), order));
+  }
+
+  /** Replaces the value with `desired` if it is equal to `expected`, in which
+      case returns true; otherwise loads the value into `expected` and returns
+      false. Two empty optionals are equal; values are compared bitwise.
+   */
+  bool compare_exchange_strong(optional<T>& expected, optional<T> const& desired,
+                               ::std::memory_order order = ::std::memory_order_seq_cst) noexcept
+  {
+    word_type w = encode(expected);
+    if (word_.compare_exchange_strong(w, encode(desired), order))
+      return true;
+    expected = codec::decode(w);
+    return false;
+  }
+
+  // Like `compare_exchange_strong()`, but may fail spuriously; for use in loops.
+  bool compare_exchange_weak(optional<T>& expected, optional<T> const& desired,
+                             ::std::memory_order order = ::std::memory_order_seq_cst) noexcept
+  {
+    word_type w = encode(expected);
+    if (word_.compare_exchange_weak(w, encode(desired), order))
+      return true;
+    expected = codec::decode(w);
+    return false;
+  }
+
+  // Stores `v` if there is no value; returns true if `v` has been stored.
+  bool emplace_if_empty(T const& v, ::std::memory_order order = ::std::memory_order_seq_cst) noexcept
+  {
+    word_type w = codec::empty();
+    return word_.compare_exchange_strong(w, codec::encode(v), order);
+  }
+
+private:
+  static word_type encode(optional<T> const& v) noexcept
+  {
+    return v ? codec::encode(*v) : codec::empty();
+  }
+
+  ::std::atomic<word_type> word_;
+};
+
+} // namespace boost
+
+#endif // BOOST_NO_CXX11_HDR_ATOMIC
+
+#endif // header guard
@@ -0,0 +1,198 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_CONCURRENT_OPTIONAL_ARRAY_19OCT2026_HPP
+#define BOOST_OPTIONAL_CONCURRENT_OPTIONAL_ARRAY_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <boost/assert.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/optional/optional_once.hpp>
+#include <boost/optional/detail/optional_aligned_allocator.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace boost { namespace optional_detail {
+
+// The states of the slots of a `concurrent_optional_array`, two bits each,
+// 32 to a word and 256 to a cache line. Going from busy to ready or back
+// to empty is an addition or a subtraction of 1.
+BOOST_CONSTEXPR_OR_CONST ::std::uint64_t memo_empty = 0;
+BOOST_CONSTEXPR_OR_CONST ::std::uint64_t memo_busy = 1;
+BOOST_CONSTEXPR_OR_CONST ::std::uint64_t memo_ready = 2;
+
+BOOST_CONSTEXPR_OR_CONST ::std::size_t memo_slots_per_word = 32;
+BOOST_CONSTEXPR_OR_CONST ::std::size_t memo_words_per_line = 8;
+BOOST_CONSTEXPR_OR_CONST ::std::size_t memo_slots_per_line = memo_slots_per_word * memo_words_per_line;
+
+struct alignas(64) memo_control_line
+{
+  ::std::atomic< ::std::uint64_t> words_[memo_words_per_line];
+
+  memo_control_line() noexcept
+  {
+    for (::std::size_t i = 0; i != memo_words_per_line; ++i)
+      words_[i].store(memo_empty, ::std::memory_order_relaxed);
+  }
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A fixed-size array of optional slots, each of which is computed at most
+    once, by the first of any number of threads that asks for it; a table
+    for memoizing a function of a small integer key. `get_or_compute(i, f)`
+    works like `optional_once<T>::get_or_init()` on slot `i`, with `f(i)`
+    constructing the value in place.
+
+    The states of the slots are kept apart from the values, packed two bits
+    a slot into cache-line-aligned control words, so that looking a slot up
+    reads one word from a line that writes to values never touch, and that
+    a few lines describe thousands of slots.
+ */
+template <class T>
+class concurrent_optional_array
+{
+  typedef optional_detail::once_storage<T> slot_type;
+
+public:
+  typedef T value_type;
+  typedef ::std::size_t size_type;
+
+  explicit concurrent_optional_array(size_type n)
+    : slots_(n), control_((n + optional_detail::memo_slots_per_line - 1) / optional_detail::memo_slots_per_line) {}
+
+  concurrent_optional_array(concurrent_optional_array const&) = delete;
+  concurrent_optional_array& operator=(concurrent_optional_array const&) = delete;
+
+  // No other thread may use the array.
+  ~concurrent_optional_array()
+  {
+    for (size_type i = 0; i != slots_.size(); ++i)
+      if (state(i, ::std::memory_order_relaxed) == optional_detail::memo_ready)
+        slots_[i].value_.~T();
+  }
+
+  size_type size() const noexcept { return slots_.size(); }
+
+  bool has_value(size_type i) const noexcept
+  {
+    return state(i, ::std::memory_order_acquire) == optional_detail::memo_ready;
+  }
+
+  // The value in slot `i`, if it has been computed.
+  optional<T&> get(size_type i) noexcept
+  {
+    return has_value(i) ? optional<T&>(slots_[i].value_) : optional<T&>();
+  }
+
+  optional<T const&> get(size_type i) const noexcept
+  {
+    return has_value(i) ? optional<T const&>(slots_[i].value_) : optional<T const&>();
+  }
+
+  /** Returns the value in slot `i`, computing it as `f(i)` first if no thread
+      has done it yet. While one thread computes a slot, the others asking for
+      it wait, blocked like the waiters of `optional_once`; if `f` throws, the slot is left empty for the next caller.
+   */
+  template <class F>
+  T& get_or_compute(size_type i, F&& f)
+  {
+    if (state(i, ::std::memory_order_acquire) != optional_detail::memo_ready)
+      compute_slow(i, f);
+    return slots_[i].value_;
+  }
+
+private:
+  ::std::atomic< ::std::uint64_t>& word(size_type i) const noexcept
+  {
+    BOOST_ASSERT(i < slots_.size());
+    return control_[i / optional_detail::memo_slots_per_line]
+             .words_[i % optional_detail::memo_slots_per_line / optional_detail::memo_slots_per_word];
+  }
+
+  static unsigned shift(size_type i) noexcept
+  {
+    return static_cast<unsigned>(i % optional_detail::memo_slots_per_word * 2);
+  }
+
+  ::std::uint64_t state(size_type i, ::std::memory_order order) const noexcept
+  {
+    return (word(i).load(order) >> shift(i)) & 3u;
+  }
+
+  // Moves slot `i` from busy back to empty if the computation throws.
+  struct compute_guard
+  {
+    ::std::atomic< ::std::uint64_t>& word_;
+    ::std::uint64_t busy_;
+    bool done_;
+
+    ~compute_guard()
+    {
+      if (!done_)
+      {
+        word_.fetch_sub(busy_, ::std::memory_order_release);
+        optional_detail::once_notify_all(word_);
+      }
+    }
+  };
+
+  template <class F>
+  void compute_slow(size_type i, F& f)
+  {
+    ::std::atomic< ::std::uint64_t>& w = word(i);
+    unsigned const s = shift(i);
+    ::std::uint64_t const busy = optional_detail::memo_busy << s;
+    ::std::uint64_t v = w.load(::std::memory_order_acquire);
+    for (;;)
+    {
+      ::std::uint64_t const st = (v >> s) & 3u;
+      if (st == optional_detail::memo_ready)
+        return;
+      if (st == optional_detail::memo_busy)
+      {
+        // wakes up when any slot in the word changes state
+        optional_detail::once_wait(w, v);
+        v = w.load(::std::memory_order_acquire);
+        continue;
+      }
+      // the CAS also fails when another slot in the word changes; retry then
+      if (w.compare_exchange_weak(v, v | busy, ::std::memory_order_acquire, ::std::memory_order_acquire))
+        break;
+    }
+
+    compute_guard g = { w, busy, false };
+    ::new (static_cast<void*>(&slots_[i].value_)) T(f(i));
+    g.done_ = true;
+    w.fetch_add(busy, ::std::memory_order_release); // busy -> ready
+    optional_detail::once_notify_all(w);
+  }
+
+  ::std::vector<slot_type> slots_;
+  // the lines are over-aligned, which `std::allocator` only honours since C++17
+  mutable ::std::vector<optional_detail::memo_control_line,
+                        optional_detail::aligned_allocator<optional_detail::memo_control_line> > control_;
+};
+
+} // namespace boost
+
+#endif // BOOST_NO_CXX11_HDR_ATOMIC
+
+#endif // header guard
@@ -0,0 +1,78 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides an allocator that honours the alignment of
+// over-aligned types, such as the cache-line-aligned elements of the
+// concurrent containers, which `std::allocator` only does since C++17.
+
+#ifndef BOOST_OPTIONAL_DETAIL_OPTIONAL_ALIGNED_ALLOCATOR_19OCT2026_HPP
+#define BOOST_OPTIONAL_DETAIL_OPTIONAL_ALIGNED_ALLOCATOR_19OCT2026_HPP
+
+#include <boost/config.hpp>
+#include <boost/throw_exception.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace boost { namespace optional_detail {
+
+template <class T>
+class aligned_allocator
+{
+public:
+  typedef T value_type;
+
+  aligned_allocator() noexcept {}
+
+  template <class U>
+  aligned_allocator(aligned_allocator<U> const&) noexcept {}
+
+  T* allocate(::std::size_t n)
+  {
+    if (n > ((::std::numeric_limits< ::std::size_t>::max)() - alignof(T) - sizeof(void*)) / sizeof(T))
+      throw_exception(::std::bad_alloc());
+#if defined(__cpp_aligned_new)
+    return static_cast<T*>(::operator new(n * sizeof(T), ::std::align_val_t(alignof(T))));
+#else
+    // Over-allocates and stores the address of the block just before the aligned one.
+    unsigned char* const raw = static_cast<unsigned char*>(::operator new(n * sizeof(T) + alignof(T) + sizeof(void*)));
+    ::std::uintptr_t const first = reinterpret_cast< ::std::uintptr_t>(raw) + sizeof(void*);
+    unsigned char* const p = raw + sizeof(void*) + (alignof(T) - first % alignof(T)) % alignof(T);
+    ::std::memcpy(p - sizeof(void*), &raw, sizeof(void*));
+    return reinterpret_cast<T*>(p);
+#endif
+  }
+
+  void deallocate(T* p, ::std::size_t n) noexcept
+  {
+#if defined(__cpp_aligned_new)
+    ::operator delete(p, n * sizeof(T), ::std::align_val_t(alignof(T)));
+#else
+    (void)n;
+    void* raw;
+    ::std::memcpy(&raw, reinterpret_cast<unsigned char*>(p) - sizeof(void*), sizeof(void*));
+    ::operator delete(raw);
+#endif
+  }
+};
+
+template <class T, class U>
+inline bool operator==(aligned_allocator<T> const&, aligned_allocator<U> const&) noexcept { return true; }
+
+template <class T, class U>
+inline bool operator!=(aligned_allocator<T> const&, aligned_allocator<U> const&) noexcept { return false; }
+
+}} // namespace boost::optional_detail
+
+#endif // header guard
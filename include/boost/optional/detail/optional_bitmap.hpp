@@ -0,0 +1,81 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides the helpers for manipulating validity bitmaps:
+// arrays of 64-bit words where bit `i % 64` of word `i / 64` tells if
+// the element at index `i` has a value.
+
+#ifndef BOOST_OPTIONAL_DETAIL_OPTIONAL_BITMAP_19OCT2026_HPP
+#define BOOST_OPTIONAL_DETAIL_OPTIONAL_BITMAP_19OCT2026_HPP
+
+#include <boost/config.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace optional_detail {
+
+typedef ::std::uint64_t bitmap_word;
+
+BOOST_INLINE_CONSTEXPR ::std::size_t bitmap_word_bits = 64;
+
+// The number of words required to store `n` bits.
+inline BOOST_CONSTEXPR ::std::size_t bitmap_words(::std::size_t n) noexcept
+{
+  return (n + bitmap_word_bits - 1) / bitmap_word_bits;
+}
+
+inline BOOST_CONSTEXPR bool bitmap_test(bitmap_word const* bits, ::std::size_t i) noexcept
+{
+  return ((bits[i / bitmap_word_bits] >> (i % bitmap_word_bits)) & 1u) != 0;
+}
+
+inline void bitmap_set(bitmap_word* bits, ::std::size_t i) noexcept
+{
+  bits[i / bitmap_word_bits] |= bitmap_word(1) << (i % bitmap_word_bits);
+}
+
+inline void bitmap_clear(bitmap_word* bits, ::std::size_t i) noexcept
+{
+  bits[i / bitmap_word_bits] &= ~(bitmap_word(1) << (i % bitmap_word_bits));
+}
+
+// Sets the bit to `b` without branching on `b`.
+inline void bitmap_assign(bitmap_word* bits, ::std::size_t i, bool b) noexcept
+{
+  bitmap_word const mask = bitmap_word(1) << (i % bitmap_word_bits);
+  bitmap_word& w = bits[i / bitmap_word_bits];
+  w = (w & ~mask) | ((bitmap_word(0) - bitmap_word(b)) & mask);
+}
+
+// The mask of the bits in the word at index `w` that correspond to
+// indices below `n`.
+inline BOOST_CONSTEXPR bitmap_word bitmap_valid_mask(::std::size_t w, ::std::size_t n) noexcept
+{
+  return (w + 1) * bitmap_word_bits <= n ? ~bitmap_word(0)
+       : w * bitmap_word_bits >= n       ? bitmap_word(0)
+       : (bitmap_word(1) << (n % bitmap_word_bits)) - 1;
+}
+
+// Number of bits set among the first `n` bits.
+inline ::std::size_t bitmap_count(bitmap_word const* bits, ::std::size_t n) noexcept
+{
+  ::std::size_t ans = 0;
+  ::std::size_t const nw = bitmap_words(n);
+  for (::std::size_t w = 0; w != nw; ++w)
+    ans += static_cast< ::std::size_t>(::boost::core::popcount(bits[w] & bitmap_valid_mask(w, n)));
+  return ans;
+}
+
+}} // namespace boost::optional_detail
+
+#endif // header guard
@@ -0,0 +1,184 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_LAZY_OPTIONAL_19OCT2026_HPP
+#define BOOST_OPTIONAL_LAZY_OPTIONAL_19OCT2026_HPP
+
+#include <boost/core/addressof.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/optional/bad_optional_access.hpp>
+#include <boost/optional/optional.hpp>
+#include <functional>
+#include <new>
+#include <type_traits>
+
+namespace boost { namespace optional_detail {
+
+// The callable until the value is computed, then the value.
+template <class T, class F>
+union lazy_storage
+{
+  unsigned char dummy_;
+  F init_;
+  T value_;
+
+  lazy_storage() noexcept : dummy_() {}
+  ~lazy_storage() {} // `lazy_optional` destroys the active member
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A value of type `T` computed by the nullary callable `F` at most once,
+    on first access, unlike `optional<T>::value_or_eval()`, which calls its
+    function on every access to an empty optional. The callable and the
+    value share the storage: on first access the callable is moved out,
+    and the value is constructed in place from its result. A value that is
+    never accessed is never computed.
+
+    If the callable throws, the exception propagates and the object is
+    left without a value or a callable; any further access then throws
+    `bad_optional_access`.
+
+    Not thread-safe: for a value computed once by any of many threads,
+    see `optional_once<T>`.
+ */
+template <class T, class F>
+class lazy_optional
+{
+  enum state_type : unsigned char { pending_state, ready_state, empty_state };
+
+public:
+  typedef T value_type;
+  typedef F initializer_type;
+
+  explicit lazy_optional(F const& f) : state_(pending_state)
+  {
+    ::new (static_cast<void*>(&storage_.init_)) F(f);
+  }
+
+  explicit lazy_optional(F&& f) : state_(pending_state)
+  {
+    ::new (static_cast<void*>(&storage_.init_)) F(optional_detail::move_(f));
+  }
+
+  lazy_optional(lazy_optional const& rhs) : state_(rhs.state_)
+  {
+    if (state_ == pending_state)
+      ::new (static_cast<void*>(&storage_.init_)) F(rhs.storage_.init_);
+    else if (state_ == ready_state)
+      ::new (static_cast<void*>(&storage_.value_)) T(rhs.storage_.value_);
+  }
+
+  lazy_optional(lazy_optional&& rhs) : state_(rhs.state_)
+  {
+    if (state_ == pending_state)
+      ::new (static_cast<void*>(&storage_.init_)) F(optional_detail::move_(rhs.storage_.init_));
+    else if (state_ == ready_state)
+      ::new (static_cast<void*>(&storage_.value_)) T(optional_detail::move_(rhs.storage_.value_));
+  }
+
+  lazy_optional& operator=(lazy_optional const&) = delete;
+
+  ~lazy_optional() { destroy(); }
+
+  // Whether the value has been computed.
+  bool has_value() const noexcept { return state_ == ready_state; }
+
+  // Whether the value is still to be computed.
+  bool is_pending() const noexcept { return state_ == pending_state; }
+
+  // The value, if it has been computed, without computing it.
+  optional<T&> peek() noexcept
+  {
+    return has_value() ? optional<T&>(storage_.value_) : optional<T&>();
+  }
+
+  optional<T const&> peek() const noexcept
+  {
+    return has_value() ? optional<T const&>(storage_.value_) : optional<T const&>();
+  }
+
+  // Computes the value if needed and returns it; throws `bad_optional_access`
+  // if the callable has thrown before.
+  T& value()
+  {
+    if (state_ != ready_state)
+      evaluate();
+    return storage_.value_;
+  }
+
+  T const& value() const
+  {
+    if (state_ != ready_state)
+      evaluate();
+    return storage_.value_;
+  }
+
+  T& operator*() { return value(); }
+  T const& operator*() const { return value(); }
+  T* operator->() { return ::boost::addressof(value()); }
+  T const* operator->() const { return ::boost::addressof(value()); }
+
+private:
+#if defined(BOOST_GCC) && (__GNUC__ >= 7)
+// false positive: GCC does not follow `state_` to the active member of the storage
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+  void evaluate() const
+  {
+    if (state_ == empty_state)
+      throw_exception(bad_optional_access());
+
+    F f(optional_detail::move_(storage_.init_));
+    storage_.init_.~F();
+    state_ = empty_state;
+    ::new (static_cast<void*>(&storage_.value_)) T(f());
+    state_ = ready_state;
+  }
+
+#if defined(BOOST_GCC) && (__GNUC__ >= 7)
+# pragma GCC diagnostic pop
+#endif
+
+  void destroy() noexcept
+  {
+    if (state_ == pending_state)
+      storage_.init_.~F();
+    else if (state_ == ready_state)
+      storage_.value_.~T();
+    state_ = empty_state;
+  }
+
+  mutable state_type state_;
+  mutable optional_detail::lazy_storage<T, F> storage_;
+};
+
+// A lazily computed `T` with a type-erased initializer.
+template <class T>
+using lazy = lazy_optional<T, ::std::function<T()> >;
+
+// Makes a `lazy_optional` of the type returned by `f`.
+template <class F>
+lazy_optional<typename ::std::decay<decltype(::std::declval<F&>()())>::type, typename ::std::decay<F>::type>
+make_lazy(F&& f)
+{
+  return lazy_optional<typename ::std::decay<decltype(::std::declval<F&>()())>::type, typename ::std::decay<F>::type>(
+      optional_detail::forward_<F>(f));
+}
+
+} // namespace boost
+
+#endif // header guard
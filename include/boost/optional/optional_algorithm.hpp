@@ -0,0 +1,190 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides `equal_optionals()`, `mismatch_optionals()` and
+// `lexicographical_compare_optionals()`: the counterparts of the Standard
+// Library algorithms for contiguous arrays of `optional<T>`. They give the
+// same results as the Standard algorithms would, using the relational
+// operators of `optional` (in particular, none is less than any value).
+//
+// For arithmetic, enumeration and pointer `T`s the arrays are compared
+// in blocks of 64 elements: for each block a mask of the differing
+// positions is computed without branches, and only a non-zero mask is
+// inspected further. Other `T`s are compared one element at a time.
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_ALGORITHM_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_ALGORITHM_19OCT2026_HPP
+
+#include <boost/optional/optional.hpp>
+#include <boost/optional/detail/optional_bitmap.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace optional_detail {
+
+template <class T>
+struct is_blockwise_comparable
+  : ::std::integral_constant<bool, ::std::is_arithmetic<T>::value ||
+                                   ::std::is_enum<T>::value ||
+                                   ::std::is_pointer<T>::value>
+{};
+
+// Reads the value, or `T()` for an empty optional, so that the result
+// can be combined with the presence flags without branching.
+template <class T>
+inline T value_or_zero(::boost::optional<T> const& o)
+{
+  return o ? *o : T();
+}
+
+// The mask of positions in `[0, len)` where `a[j] != b[j]`.
+template <class T>
+inline bitmap_word not_equal_mask(::boost::optional<T> const* a, ::boost::optional<T> const* b, ::std::size_t len)
+{
+  bitmap_word m = 0;
+  for (::std::size_t j = 0; j != len; ++j)
+  {
+    bool const ha = bool(a[j]), hb = bool(b[j]);
+    bool const eq = value_or_zero(a[j]) == value_or_zero(b[j]);
+    bool const ne = (ha != hb) | (ha & !eq);
+    m |= bitmap_word(ne) << j;
+  }
+  return m;
+}
+
+template <class T>
+::std::pair< ::boost::optional<T> const*, ::boost::optional<T> const*>
+mismatch_impl(::boost::optional<T> const* a, ::boost::optional<T> const* b, ::std::size_t n, ::std::true_type)
+{
+  for (::std::size_t base = 0; base < n; base += bitmap_word_bits)
+  {
+    ::std::size_t const len = n - base < bitmap_word_bits ? n - base : bitmap_word_bits;
+    bitmap_word const m = not_equal_mask(a + base, b + base, len);
+    if (m != 0)
+    {
+      ::std::size_t const j = base + static_cast< ::std::size_t>(::boost::core::countr_zero(m));
+      return ::std::make_pair(a + j, b + j);
+    }
+  }
+  return ::std::make_pair(a + n, b + n);
+}
+
+template <class T>
+::std::pair< ::boost::optional<T> const*, ::boost::optional<T> const*>
+mismatch_impl(::boost::optional<T> const* a, ::boost::optional<T> const* b, ::std::size_t n, ::std::false_type)
+{
+  ::std::size_t j = 0;
+  while (j != n && a[j] == b[j])
+    ++j;
+  return ::std::make_pair(a + j, b + j);
+}
+
+// Returns `-1` if `a` is lexicographically less than `b` on the first `n`
+// elements, `1` if it is greater, and `0` if they are equivalent.
+template <class T>
+int lexicographical_compare_impl(::boost::optional<T> const* a, ::boost::optional<T> const* b, ::std::size_t n, ::std::true_type)
+{
+  for (::std::size_t base = 0; base < n; base += bitmap_word_bits)
+  {
+    ::std::size_t const len = n - base < bitmap_word_bits ? n - base : bitmap_word_bits;
+    bitmap_word lt = 0, gt = 0;
+    for (::std::size_t j = 0; j != len; ++j)
+    {
+      ::boost::optional<T> const& x = a[base + j];
+      ::boost::optional<T> const& y = b[base + j];
+      bool const hx = bool(x), hy = bool(y);
+      T const vx = value_or_zero(x), vy = value_or_zero(y);
+      bool const less = vx < vy, greater = vy < vx;
+      lt |= bitmap_word(hy & (!hx | less)) << j;
+      gt |= bitmap_word(hx & (!hy | greater)) << j;
+    }
+    if ((lt | gt) != 0)
+      return ((lt >> ::boost::core::countr_zero(lt | gt)) & 1u) ? -1 : 1;
+  }
+  return 0;
+}
+
+template <class T>
+int lexicographical_compare_impl(::boost::optional<T> const* a, ::boost::optional<T> const* b, ::std::size_t n, ::std::false_type)
+{
+  for (::std::size_t j = 0; j != n; ++j)
+  {
+    if (a[j] < b[j])
+      return -1;
+    if (b[j] < a[j])
+      return 1;
+  }
+  return 0;
+}
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** Returns the first position where `[first1, last1)` and the array
+    starting at `first2` differ, as `std::mismatch()` would.
+ */
+template <class T>
+::std::pair<optional<T> const*, optional<T> const*>
+mismatch_optionals(optional<T> const* first1, optional<T> const* last1, optional<T> const* first2)
+{
+  return optional_detail::mismatch_impl(first1, first2, static_cast< ::std::size_t>(last1 - first1),
+                                        optional_detail::is_blockwise_comparable<T>());
+}
+
+template <class T>
+::std::pair<optional<T> const*, optional<T> const*>
+mismatch_optionals(optional<T> const* first1, optional<T> const* last1,
+                   optional<T> const* first2, optional<T> const* last2)
+{
+  ::std::size_t const n1 = static_cast< ::std::size_t>(last1 - first1);
+  ::std::size_t const n2 = static_cast< ::std::size_t>(last2 - first2);
+  return optional_detail::mismatch_impl(first1, first2, n1 < n2 ? n1 : n2,
+                                        optional_detail::is_blockwise_comparable<T>());
+}
+
+/** Returns `true` if `[first1, last1)` and the array of the same length
+    starting at `first2` compare equal element-wise, as `std::equal()` would.
+ */
+template <class T>
+bool equal_optionals(optional<T> const* first1, optional<T> const* last1, optional<T> const* first2)
+{
+  return mismatch_optionals(first1, last1, first2).first == last1;
+}
+
+template <class T>
+bool equal_optionals(optional<T> const* first1, optional<T> const* last1,
+                     optional<T> const* first2, optional<T> const* last2)
+{
+  return last1 - first1 == last2 - first2 && equal_optionals(first1, last1, first2);
+}
+
+/** Returns `true` if `[first1, last1)` is lexicographically less than
+    `[first2, last2)`, as `std::lexicographical_compare()` would.
+ */
+template <class T>
+bool lexicographical_compare_optionals(optional<T> const* first1, optional<T> const* last1,
+                                       optional<T> const* first2, optional<T> const* last2)
+{
+  ::std::size_t const n1 = static_cast< ::std::size_t>(last1 - first1);
+  ::std::size_t const n2 = static_cast< ::std::size_t>(last2 - first2);
+  int const cmp = optional_detail::lexicographical_compare_impl(first1, first2, n1 < n2 ? n1 : n2,
+                                                                optional_detail::is_blockwise_comparable<T>());
+  return cmp != 0 ? cmp < 0 : n1 < n2;
+}
+
+} // namespace boost
+
+#endif // header guard
@@ -0,0 +1,206 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides batch hashing of columns of optional values, for
+// use in hash joins and group-by operations. Unlike `std::hash<optional<T>>`
+// the empty state does not hash to 0, but to a configurable value, and
+// all hashes depend on a configurable seed.
+//
+// Columns are processed in groups of `lanes` elements: first the keys and
+// presence flags of the whole group are gathered, then the group is mixed
+// by a loop with no dependencies between the iterations, which compilers
+// vectorize.
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_BATCH_HASH_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_BATCH_HASH_19OCT2026_HPP
+
+#include <boost/optional/optional.hpp>
+#include <boost/optional/optional_bitmap_span.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace boost { namespace optional_detail {
+
+// Integral and enumeration values are mixed directly,
+// other types go through `std::hash` first.
+template <class T, bool Direct = ::std::is_integral<T>::value || ::std::is_enum<T>::value>
+struct hash_key
+{
+  static ::std::uint64_t get(T const& v) { return static_cast< ::std::uint64_t>(v); }
+};
+
+template <class T>
+struct hash_key<T, false>
+{
+  static ::std::uint64_t get(T const& v) { return static_cast< ::std::uint64_t>(::std::hash<T>()(v)); }
+};
+
+// The finalizer of MurmurHash3.
+inline BOOST_CXX14_CONSTEXPR ::std::uint64_t hash_mix(::std::uint64_t x) noexcept
+{
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdull;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ull;
+  x ^= x >> 33;
+  return x;
+}
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A hash function for optional values, parametrized by a seed and
+    by the hash value of the empty state.
+ */
+class optional_batch_hasher
+{
+public:
+  // The number of elements mixed together in the batch algorithms.
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t lanes = 8;
+
+  explicit optional_batch_hasher(::std::uint64_t seed = 0) noexcept
+    : seed_(seed + 0x9e3779b97f4a7c15ull)
+    , empty_hash_(optional_detail::hash_mix(seed ^ 0x5bd1e9955bd1e995ull) | 1u)
+  {}
+
+  optional_batch_hasher(::std::uint64_t seed, ::std::uint64_t empty_hash) noexcept
+    : seed_(seed + 0x9e3779b97f4a7c15ull)
+    , empty_hash_(empty_hash)
+  {}
+
+  ::std::uint64_t seed() const noexcept { return seed_ - 0x9e3779b97f4a7c15ull; }
+  ::std::uint64_t empty_hash() const noexcept { return empty_hash_; }
+
+  template <class T>
+  ::std::uint64_t hash_value(T const& v) const
+  {
+    return mix(optional_detail::hash_key<T>::get(v));
+  }
+
+  template <class T>
+  ::std::uint64_t operator()(optional<T> const& o) const
+  {
+    return o ? hash_value(*o) : empty_hash_;
+  }
+
+  // The hash of a gathered key: `has` selects between the mixed key and the empty hash.
+  ::std::uint64_t select(bool has, ::std::uint64_t key) const noexcept
+  {
+    return has ? mix(key) : empty_hash_;
+  }
+
+private:
+  ::std::uint64_t mix(::std::uint64_t key) const noexcept
+  {
+    return optional_detail::hash_mix(key ^ seed_);
+  }
+
+  ::std::uint64_t seed_;
+  ::std::uint64_t empty_hash_;
+};
+
+} // namespace boost
+
+
+namespace boost { namespace optional_detail {
+
+template <class Reader, class OutputIt>
+OutputIt hash_column_impl(Reader const& r, ::std::size_t n, OutputIt out, ::boost::optional_batch_hasher const& h)
+{
+  ::std::size_t const lanes = ::boost::optional_batch_hasher::lanes;
+
+  ::std::size_t i = 0;
+  for (; i + lanes <= n; i += lanes)
+  {
+    bool has[lanes];
+    ::std::uint64_t key[lanes];
+    for (::std::size_t j = 0; j != lanes; ++j)
+    {
+      has[j] = r.has(i + j);
+      key[j] = r.key(i + j);
+    }
+
+    ::std::uint64_t hash[lanes];
+    for (::std::size_t j = 0; j != lanes; ++j)
+      hash[j] = h.select(has[j], key[j]);
+
+    for (::std::size_t j = 0; j != lanes; ++j, ++out)
+      *out = hash[j];
+  }
+
+  for (; i != n; ++i, ++out)
+    *out = h.select(r.has(i), r.key(i));
+  return out;
+}
+
+template <class RandomIt>
+struct hash_optional_reader
+{
+  typedef typename ::std::iterator_traits<RandomIt>::value_type optional_type;
+  typedef typename ::std::remove_cv<typename optional_type::value_type>::type value_type;
+
+  RandomIt it_;
+
+  bool has(::std::size_t i) const { return bool(it_[i]); }
+  ::std::uint64_t key(::std::size_t i) const { return it_[i] ? hash_key<value_type>::get(*it_[i]) : 0u; }
+};
+
+template <class T>
+struct hash_bitmap_reader
+{
+  typedef typename ::std::remove_cv<T>::type value_type;
+
+  ::boost::optional_bitmap_span<T> span_;
+
+  bool has(::std::size_t i) const { return bitmap_test(span_.bits(), i); }
+
+  // The slots without a value hold valid objects, so they can be hashed
+  // unconditionally; the result is discarded later.
+  ::std::uint64_t key(::std::size_t i) const { return hash_key<value_type>::get(span_.values()[i]); }
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** Writes the hash of every element in the random-access range `[first, last)`
+    of `optional<T>`s to `out`, as computed by `h`. Returns the iterator past
+    the last element written.
+ */
+template <class RandomIt, class OutputIt>
+OutputIt hash_column(RandomIt first, RandomIt last, OutputIt out,
+                     optional_batch_hasher const& h = optional_batch_hasher())
+{
+  optional_detail::hash_optional_reader<RandomIt> const r = { first };
+  return optional_detail::hash_column_impl(r, static_cast< ::std::size_t>(last - first), out, h);
+}
+
+/** Writes the hash of every element of `col` to `out`, as computed by `h`.
+    Returns the iterator past the last element written.
+ */
+template <class T, class OutputIt>
+OutputIt hash_column(optional_bitmap_span<T> const& col, OutputIt out,
+                     optional_batch_hasher const& h = optional_batch_hasher())
+{
+  optional_detail::hash_bitmap_reader<T> const r = { col };
+  return optional_detail::hash_column_impl(r, col.size(), out, h);
+}
+
+} // namespace boost
+
+#endif // header guard
@@ -0,0 +1,109 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_BITMAP_SPAN_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_BITMAP_SPAN_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/optional/detail/optional_bitmap.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost {
+
+/** A non-owning view of a column of optional values stored in the
+    "columnar" layout: a dense array of `size()` values of type `T` and
+    a separate validity bitmap, where bit `i % 64` of word `i / 64` tells
+    if the value at index `i` is present.
+
+    Values at the positions whose validity bit is not set must still be
+    valid (initialized) objects of type `T`; their content is unspecified.
+    This allows the bulk algorithms to read them unconditionally and
+    select the result with masks rather than branches.
+
+    If `T` is `const`-qualified the view is read-only and the bitmap
+    is also accessed through a pointer to `const`.
+ */
+template <class T>
+class optional_bitmap_span
+{
+public:
+  typedef T value_type;
+  typedef optional_detail::bitmap_word word_type;
+  typedef typename ::std::conditional< ::std::is_const<T>::value,
+                                       word_type const,
+                                       word_type>::type bitmap_type;
+
+  BOOST_CONSTEXPR optional_bitmap_span() noexcept
+    : bits_(nullptr), values_(nullptr), size_(0) {}
+
+  BOOST_CONSTEXPR optional_bitmap_span(bitmap_type* bits, T* values, ::std::size_t size) noexcept
+    : bits_(bits), values_(values), size_(size) {}
+
+  // A view of mutable data converts to a view of const data.
+  template <class U, BOOST_OPTIONAL_REQUIRES(::std::is_same<U const, T>),
+                     BOOST_OPTIONAL_REQUIRES(!::std::is_same<U, T>)>
+  BOOST_CONSTEXPR optional_bitmap_span(optional_bitmap_span<U> const& rhs) noexcept
+    : bits_(rhs.bits()), values_(rhs.values()), size_(rhs.size()) {}
+
+  BOOST_CONSTEXPR ::std::size_t size() const noexcept { return size_; }
+  BOOST_CONSTEXPR bool empty() const noexcept { return size_ == 0; }
+
+  BOOST_CONSTEXPR bitmap_type* bits() const noexcept { return bits_; }
+  BOOST_CONSTEXPR T* values() const noexcept { return values_; }
+
+  BOOST_CONSTEXPR bool has_value(::std::size_t i) const noexcept
+  {
+    return BOOST_OPTIONAL_ASSERTED_EXPRESSION(i < size_, optional_detail::bitmap_test(bits_, i));
+  }
+
+  // Unchecked access to the value slot, regardless of the validity bit.
+  BOOST_CONSTEXPR T& value(::std::size_t i) const noexcept
+  {
+    return BOOST_OPTIONAL_ASSERTED_EXPRESSION(i < size_, values_[i]);
+  }
+
+  optional<T&> operator[](::std::size_t i) const noexcept
+  {
+    return has_value(i) ? optional<T&>(values_[i]) : optional<T&>();
+  }
+
+  // The number of elements that have a value.
+  ::std::size_t count() const noexcept
+  {
+    return optional_detail::bitmap_count(bits_, size_);
+  }
+
+  optional_bitmap_span subspan(::std::size_t first_word, ::std::size_t word_count) const noexcept
+  {
+    BOOST_ASSERT(first_word * optional_detail::bitmap_word_bits <= size_);
+    ::std::size_t const first = first_word * optional_detail::bitmap_word_bits;
+    ::std::size_t const last = (first_word + word_count) * optional_detail::bitmap_word_bits;
+    return optional_bitmap_span(bits_ + first_word, values_ + first, (last < size_ ? last : size_) - first);
+  }
+
+private:
+  bitmap_type* bits_;
+  T* values_;
+  ::std::size_t size_;
+};
+
+template <class T>
+inline BOOST_CONSTEXPR optional_bitmap_span<T>
+make_optional_bitmap_span(typename optional_bitmap_span<T>::bitmap_type* bits, T* values, ::std::size_t size) noexcept
+{
+  return optional_bitmap_span<T>(bits, values, size);
+}
+
+} // namespace boost
+
+#endif // header guard
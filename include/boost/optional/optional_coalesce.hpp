@@ -0,0 +1,131 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides bulk counterparts of `value_or()`:
+//   * `value_or_fill()` replaces every missing value in a column
+//     with a default and writes out a dense sequence of `T`s,
+//   * `coalesce_n()` picks, for every row, the first present value
+//     among several columns, or a default.
+//
+// A column is either a random-access iterator to `optional<T>` or
+// an `optional_bitmap_span<T>`. The kernels have no data-dependent
+// branches: each row starts from the default and is overwritten by
+// a conditional select (a "masked blend") per column, which compilers
+// turn into blend instructions for arithmetic `T`s.
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_COALESCE_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_COALESCE_19OCT2026_HPP
+
+#include <boost/optional/optional.hpp>
+#include <boost/optional/optional_bitmap_span.hpp>
+#include <cstddef>
+
+namespace boost { namespace optional_detail {
+
+// Uniform read access to the supported column layouts.
+template <class It>
+struct column_reader
+{
+  It it_;
+
+  bool has(::std::size_t i) const { return bool(it_[i]); }
+  auto value(::std::size_t i) const -> decltype(*it_[i]) { return *it_[i]; }
+};
+
+template <class T>
+struct column_reader< ::boost::optional_bitmap_span<T> >
+{
+  ::boost::optional_bitmap_span<T> span_;
+
+  bool has(::std::size_t i) const { return bitmap_test(span_.bits(), i); }
+  T& value(::std::size_t i) const { return span_.values()[i]; }
+};
+
+template <class Col>
+inline column_reader<Col> make_column_reader(Col const& col)
+{
+  column_reader<Col> ans = { col };
+  return ans;
+}
+
+// The columns are blended from the last one to the first one,
+// so that the first present value wins.
+template <class T>
+inline void coalesce_blend(T&, ::std::size_t)
+{
+}
+
+template <class T, class R, class... Rs>
+inline void coalesce_blend(T& r, ::std::size_t i, R const& c, Rs const&... cs)
+{
+  coalesce_blend(r, i, cs...);
+  r = c.has(i) ? static_cast<T>(c.value(i)) : r;
+}
+
+template <class OutputIt, class T, class... Readers>
+OutputIt coalesce_n_impl(::std::size_t n, OutputIt out, T const& def, Readers const&... rs)
+{
+  for (::std::size_t i = 0; i != n; ++i, ++out)
+  {
+    T r = def;
+    coalesce_blend(r, i, rs...);
+    *out = r;
+  }
+  return out;
+}
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** For each `i` in `[0, n)` writes to the `i`-th position of `out`
+    the value of the first column that has a value at index `i`,
+    or `def` if no column has one. Returns the iterator past the last
+    element written.
+
+    Each of `cols` is a random-access iterator to `optional<U>` with `U`
+    convertible to `T`, or an `optional_bitmap_span<U>` of size at least `n`.
+ */
+template <class OutputIt, class T, class... Cols>
+OutputIt coalesce_n(::std::size_t n, OutputIt out, T const& def, Cols const&... cols)
+{
+  static_assert(sizeof...(Cols) > 0, "coalesce_n() requires at least one column");
+  return optional_detail::coalesce_n_impl(n, out, def, optional_detail::make_column_reader(cols)...);
+}
+
+/** Writes `*it` for every element of `[first, last)` that has a value, and
+    `def` for every element that does not. Returns the iterator past the last
+    element written.
+ */
+template <class InputIt, class OutputIt, class T>
+OutputIt value_or_fill(InputIt first, InputIt last, OutputIt out, T const& def)
+{
+  for (; first != last; ++first, ++out)
+    *out = *first ? static_cast<T>(**first) : def;
+  return out;
+}
+
+/** Writes the values of `col`, substituting `def` for every element
+    that does not have a value. Returns the iterator past the last
+    element written.
+ */
+template <class U, class OutputIt, class T>
+OutputIt value_or_fill(optional_bitmap_span<U> const& col, OutputIt out, T const& def)
+{
+  return coalesce_n(col.size(), out, def, col);
+}
+
+} // namespace boost
+
+
+#endif // header guard
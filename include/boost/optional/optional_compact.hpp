@@ -0,0 +1,194 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides stream compaction for columns of optional values:
+//   * `compact_present()` writes out the present values (and optionally
+//     their indices) as a dense sequence,
+//   * `scatter_present()` is the inverse operation.
+//
+// Both layouts are processed in blocks of 64 elements. For a bitmap column
+// the block mask is the bitmap word; for a random-access range of `optional`s
+// it is assembled from the `has_value()` flags without branching. The present
+// elements of a block are then visited by repeatedly extracting the lowest
+// set bit of the mask, and fully populated blocks are copied straight through.
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_COMPACT_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_COMPACT_19OCT2026_HPP
+
+#include <boost/optional/optional.hpp>
+#include <boost/optional/optional_bitmap_span.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+#include <utility>
+
+namespace boost { namespace optional_detail {
+
+// An output iterator that ignores whatever is written through it.
+struct discard_output
+{
+  struct proxy
+  {
+    template <class U> proxy& operator=(U const&) { return *this; }
+  };
+
+  proxy operator*() const { return proxy(); }
+  discard_output& operator++() { return *this; }
+  discard_output operator++(int) { return *this; }
+};
+
+template <class RandomIt>
+inline bitmap_word presence_mask(RandomIt block, ::std::size_t len)
+{
+  bitmap_word m = 0;
+  for (::std::size_t j = 0; j != len; ++j)
+    m |= bitmap_word(bool(block[j])) << j;
+  return m;
+}
+
+// `get(j)` yields the value at offset `j` within the block.
+template <class Get, class OutputIt, class IndexIt>
+inline void compact_block(bitmap_word m, ::std::size_t len, ::std::size_t base,
+                          Get const& get, OutputIt& out, IndexIt& iout)
+{
+  if (m == bitmap_valid_mask(0, len))
+  {
+    for (::std::size_t j = 0; j != len; ++j, ++out, ++iout)
+    {
+      *out = get(j);
+      *iout = base + j;
+    }
+  }
+  else
+  {
+    for (; m != 0; m &= m - 1, ++out, ++iout)
+    {
+      ::std::size_t const j = static_cast< ::std::size_t>(::boost::core::countr_zero(m));
+      *out = get(j);
+      *iout = base + j;
+    }
+  }
+}
+
+template <class RandomIt>
+struct optional_block_getter
+{
+  RandomIt block_;
+  auto operator()(::std::size_t j) const -> decltype(*block_[j]) { return *block_[j]; }
+};
+
+template <class T>
+struct dense_block_getter
+{
+  T* block_;
+  T& operator()(::std::size_t j) const { return block_[j]; }
+};
+
+template <class RandomIt, class OutputIt, class IndexIt>
+::std::pair<OutputIt, IndexIt>
+compact_present_impl(RandomIt first, RandomIt last, OutputIt out, IndexIt iout)
+{
+  ::std::size_t const n = static_cast< ::std::size_t>(last - first);
+  for (::std::size_t base = 0; base < n; base += bitmap_word_bits)
+  {
+    ::std::size_t const len = n - base < bitmap_word_bits ? n - base : bitmap_word_bits;
+    RandomIt const block = first + base;
+    optional_block_getter<RandomIt> const get = { block };
+    compact_block(presence_mask(block, len), len, base, get, out, iout);
+  }
+  return ::std::pair<OutputIt, IndexIt>(out, iout);
+}
+
+template <class T, class OutputIt, class IndexIt>
+::std::pair<OutputIt, IndexIt>
+compact_present_impl(::boost::optional_bitmap_span<T> const& col, OutputIt out, IndexIt iout)
+{
+  ::std::size_t const n = col.size();
+  for (::std::size_t w = 0, base = 0; base < n; ++w, base += bitmap_word_bits)
+  {
+    ::std::size_t const len = n - base < bitmap_word_bits ? n - base : bitmap_word_bits;
+    dense_block_getter<T> const get = { col.values() + base };
+    compact_block(col.bits()[w] & bitmap_valid_mask(w, n), len, base, get, out, iout);
+  }
+  return ::std::pair<OutputIt, IndexIt>(out, iout);
+}
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** Writes the values of those elements in `[first, last)` that have a value
+    to `out`, preserving their order. Returns the iterator past the last
+    element written.
+ */
+template <class RandomIt, class OutputIt>
+OutputIt compact_present(RandomIt first, RandomIt last, OutputIt out)
+{
+  return optional_detail::compact_present_impl(first, last, out, optional_detail::discard_output()).first;
+}
+
+/** Writes the values of those elements in `[first, last)` that have a value
+    to `out`, and their indices (counted from `first`) to `iout`.
+    Returns the pair of iterators past the last elements written.
+ */
+template <class RandomIt, class OutputIt, class IndexIt>
+::std::pair<OutputIt, IndexIt> compact_present(RandomIt first, RandomIt last, OutputIt out, IndexIt iout)
+{
+  return optional_detail::compact_present_impl(first, last, out, iout);
+}
+
+template <class T, class OutputIt>
+OutputIt compact_present(optional_bitmap_span<T> const& col, OutputIt out)
+{
+  return optional_detail::compact_present_impl(col, out, optional_detail::discard_output()).first;
+}
+
+template <class T, class OutputIt, class IndexIt>
+::std::pair<OutputIt, IndexIt> compact_present(optional_bitmap_span<T> const& col, OutputIt out, IndexIt iout)
+{
+  return optional_detail::compact_present_impl(col, out, iout);
+}
+
+/** For each value `v` in `[first, last)` and the corresponding index `i`
+    from the sequence starting at `ifirst`, assigns `v` to `dest[i]`.
+    Elements of `dest` that are not referred to are left untouched.
+    Returns the iterator past the last index read.
+ */
+template <class InputIt, class IndexIt, class RandomIt>
+IndexIt scatter_present(InputIt first, InputIt last, IndexIt ifirst, RandomIt dest)
+{
+  for (; first != last; ++first, ++ifirst)
+    dest[*ifirst] = *first;
+  return ifirst;
+}
+
+/** Assigns consecutive values from the sequence starting at `first` to
+    the elements of `dest` that have their validity bit set, in the order
+    of their indices. This is the inverse of `compact_present(dest, out)`.
+    Returns the iterator past the last value read.
+ */
+template <class InputIt, class T>
+InputIt scatter_present(InputIt first, optional_bitmap_span<T> const& dest)
+{
+  ::std::size_t const n = dest.size();
+  for (::std::size_t w = 0, base = 0; base < n; ++w, base += optional_detail::bitmap_word_bits)
+  {
+    optional_detail::bitmap_word m = dest.bits()[w] & optional_detail::bitmap_valid_mask(w, n);
+    for (; m != 0; m &= m - 1, ++first)
+      dest.values()[base + static_cast< ::std::size_t>(::boost::core::countr_zero(m))] = *first;
+  }
+  return first;
+}
+
+} // namespace boost
+
+#endif // header guard
@@ -0,0 +1,306 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header makes `optional<T>` usable as the return type of a C++20
+// coroutine, in which `co_await o`, for an optional `o`, gives the value of
+// `o` if it has one, and otherwise ends the coroutine, which then returns
+// none; `co_return v` returns `v` (which may be none):
+//
+//     optional<int> port_of(config const& c)
+//     {
+//       std::string const& s = co_await c.find("port");
+//       int p = co_await parse_int(s);
+//       co_return p;
+//     }
+//
+// Such a coroutine never remains suspended: it either runs to completion
+// or is destroyed at the first empty operand, before its caller resumes.
+// The frames of the coroutines running on a thread are therefore created
+// and destroyed in LIFO order, and are allocated from a thread-local stack
+// of memory blocks that are kept for reuse, so that after the first calls
+// the coroutines do not allocate memory.
+//
+// The operands of `co_await` are restricted to optionals, so that no other
+// awaitable can suspend the coroutine.
+//
+// The result is written into the object returned by `get_return_object()`,
+// which is converted to `optional<T>` when the coroutine first returns to
+// its caller. The standard leaves open whether that conversion may happen
+// earlier, before the body runs (CWG2563); with such an eager conversion,
+// or with a copy of the returned object, the result would be lost, and no
+// design can deliver it into an `optional<T>` returned by value. The
+// support is therefore enabled only for the compilers on which the deferred
+// conversion has been tested, GCC 12 and later, and sets the macro
+// `BOOST_OPTIONAL_HAS_COROUTINE_SUPPORT`. Defining
+// `BOOST_OPTIONAL_CONFIG_ASSUME_DEFERRED_COROUTINE_RETURN` enables it for
+// other compilers; in debug builds an eager conversion then fails an assertion.
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_COROUTINE_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_COROUTINE_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_NO_CXX20_HDR_COROUTINE) && defined(__cpp_impl_coroutine) \
+    && ((defined(BOOST_GCC) && BOOST_GCC >= 120000) || defined(BOOST_OPTIONAL_CONFIG_ASSUME_DEFERRED_COROUTINE_RETURN))
+
+#define BOOST_OPTIONAL_HAS_COROUTINE_SUPPORT
+
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/optional/optional.hpp>
+#include <coroutine>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace boost { namespace optional_detail {
+
+// A stack of memory blocks from which the coroutine frames of a thread are
+// allocated by bumping a pointer and freed by moving it back. An emptied
+// block is kept as a spare for the next time the stack grows.
+class coroutine_frame_stack
+{
+  struct block
+  {
+    block* prev_;
+    ::std::size_t size_;
+    ::std::size_t used_;
+  };
+
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t alignment = alignof(::std::max_align_t);
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t header_size = (sizeof(block) + alignment - 1) / alignment * alignment;
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t default_block_size = 16 * 1024;
+
+public:
+  coroutine_frame_stack() noexcept : top_(nullptr), spare_(nullptr) {}
+
+  coroutine_frame_stack(coroutine_frame_stack const&) = delete;
+  coroutine_frame_stack& operator=(coroutine_frame_stack const&) = delete;
+
+  ~coroutine_frame_stack()
+  {
+    ::std::free(spare_);
+    while (top_)
+    {
+      block* const b = top_;
+      top_ = b->prev_;
+      ::std::free(b);
+    }
+  }
+
+  static coroutine_frame_stack& local() noexcept
+  {
+    thread_local coroutine_frame_stack s;
+    return s;
+  }
+
+  void* allocate(::std::size_t n)
+  {
+    n = round_up(n);
+    if (!top_ || top_->size_ - top_->used_ < n)
+      push_block(n);
+    void* const p = data(top_) + top_->used_;
+    top_->used_ += n;
+    return p;
+  }
+
+  void deallocate(void* p, ::std::size_t n) noexcept
+  {
+    n = round_up(n);
+    BOOST_ASSERT(top_ && top_->used_ >= n && p == data(top_) + top_->used_ - n);
+    (void)p;
+    top_->used_ -= n;
+    if (top_->used_ == 0 && top_->prev_)
+      pop_block();
+  }
+
+private:
+  static ::std::size_t round_up(::std::size_t n) noexcept
+  {
+    return (n + alignment - 1) / alignment * alignment;
+  }
+
+  static unsigned char* data(block* b) noexcept
+  {
+    return reinterpret_cast<unsigned char*>(b) + header_size;
+  }
+
+  void push_block(::std::size_t n)
+  {
+    block* b = nullptr;
+    if (spare_ && spare_->size_ >= n)
+    {
+      b = spare_;
+      spare_ = nullptr;
+    }
+    else
+    {
+      ::std::size_t const size = n > default_block_size ? n : default_block_size;
+      b = static_cast<block*>(::std::malloc(header_size + size));
+      if (!b)
+        throw_exception(::std::bad_alloc());
+      b->size_ = size;
+    }
+    b->prev_ = top_;
+    b->used_ = 0;
+    top_ = b;
+  }
+
+  void pop_block() noexcept
+  {
+    block* const b = top_;
+    top_ = b->prev_;
+    if (spare_ && spare_->size_ >= b->size_)
+      ::std::free(b);
+    else
+    {
+      ::std::free(spare_);
+      spare_ = b;
+    }
+  }
+
+  block* top_;
+  block* spare_;
+};
+
+// The object returned by `get_return_object()`, into which the coroutine
+// stores its result, converted to `optional<T>` when the coroutine returns
+// to its caller. It can be neither copied nor moved, as the promise keeps
+// its address; `finished_` is set when the frame is destroyed.
+template <class T>
+class coroutine_result
+{
+public:
+  explicit coroutine_result(coroutine_result*& slot) noexcept : finished_(false) { slot = this; }
+
+  coroutine_result(coroutine_result const&) = delete;
+  coroutine_result& operator=(coroutine_result const&) = delete;
+
+  operator optional<T>()
+  {
+    BOOST_ASSERT_MSG(finished_, "optional<T> coroutine: the return object was converted before the body ran");
+    return optional_detail::move_(value_);
+  }
+
+  optional<T> value_;
+  bool finished_;
+};
+
+// The awaiter of an lvalue operand, giving a reference to its value.
+template <class O>
+class optional_awaiter
+{
+public:
+  explicit optional_awaiter(O& o) noexcept : o_(o) {}
+
+  bool await_ready() const noexcept { return o_.has_value(); }
+
+  // The operand is empty: the coroutine ends, leaving its result empty.
+  void await_suspend(::std::coroutine_handle<> h) const noexcept { h.destroy(); }
+
+  decltype(auto) await_resume() const noexcept { return *o_; }
+
+protected:
+  O& o_;
+};
+
+// The awaiter of an rvalue operand, which may not outlive the expression,
+// giving its value by value.
+template <class U>
+class optional_rvalue_awaiter : public optional_awaiter<optional<U> >
+{
+public:
+  explicit optional_rvalue_awaiter(optional<U>& o) noexcept : optional_awaiter<optional<U> >(o) {}
+
+  U await_resume() const { return static_cast<U&&>(*this->o_); }
+};
+
+template <class T>
+class optional_promise
+{
+public:
+  static void* operator new(::std::size_t n)
+  {
+    return coroutine_frame_stack::local().allocate(n);
+  }
+
+  static void operator delete(void* p, ::std::size_t n) noexcept
+  {
+    coroutine_frame_stack::local().deallocate(p, n);
+  }
+
+  optional_promise() noexcept : result_(nullptr) {}
+
+  ~optional_promise()
+  {
+    if (result_)
+      result_->finished_ = true;
+  }
+
+  coroutine_result<T> get_return_object() noexcept { return coroutine_result<T>(result_); }
+
+  ::std::suspend_never initial_suspend() const noexcept { return ::std::suspend_never(); }
+  ::std::suspend_never final_suspend() const noexcept { return ::std::suspend_never(); }
+
+  template <class U = T>
+  void return_value(U&& v)
+  {
+    result_->value_ = optional_detail::forward_<U>(v);
+  }
+
+  // Lets the exception leave the coroutine, which has not been suspended,
+  // so that it propagates to the caller, with the frame destroyed. The
+  // return object may be destroyed first, and is not converted.
+  void unhandled_exception()
+  {
+    result_ = nullptr;
+    throw;
+  }
+
+  template <class U>
+  optional_awaiter<optional<U> const> await_transform(optional<U> const& o) const noexcept
+  {
+    return optional_awaiter<optional<U> const>(o);
+  }
+
+  template <class U>
+  optional_awaiter<optional<U> > await_transform(optional<U>& o) const noexcept
+  {
+    return optional_awaiter<optional<U> >(o);
+  }
+
+  template <class U>
+  optional_rvalue_awaiter<U> await_transform(optional<U>&& o) const noexcept
+  {
+    return optional_rvalue_awaiter<U>(o);
+  }
+
+private:
+  coroutine_result<T>* result_;
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace std {
+
+template <class T, class... Args>
+struct coroutine_traits< ::boost::optional<T>, Args...>
+{
+  typedef ::boost::optional_detail::optional_promise<T> promise_type;
+};
+
+} // namespace std
+
+#endif // BOOST_OPTIONAL_HAS_COROUTINE_SUPPORT
+
+#endif // header guard
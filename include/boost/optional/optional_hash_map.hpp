@@ -0,0 +1,511 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides open-addressing hash containers whose slots are
+// uninitialized storage, like that of `optional`, with the presence flags
+// moved out of the slots into an array of control bytes.
+//
+// Each control byte is either `ctrl_empty`, `ctrl_deleted` or, for a slot
+// holding a value, the 7 low bits of the value's hash. The control bytes
+// are scanned 8 at a time, as a 64-bit word: a lookup finds the candidate
+// slots of a group with a few arithmetic operations and only compares the
+// keys of the slots whose hash bits match.
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_HASH_MAP_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_HASH_MAP_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/optional/optional.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace optional_detail {
+
+// The storage of a slot; the control byte records whether it holds a value.
+template <class T>
+union hash_slot
+{
+  unsigned char dummy_;
+  T value_;
+
+  hash_slot() noexcept : dummy_() {}
+  ~hash_slot() {} // the table destroys the `T` if needed
+};
+
+typedef unsigned char hash_ctrl;
+
+BOOST_CONSTEXPR_OR_CONST hash_ctrl ctrl_empty = 0x80;
+BOOST_CONSTEXPR_OR_CONST hash_ctrl ctrl_deleted = 0xfe;
+
+BOOST_CONSTEXPR_OR_CONST ::std::size_t hash_group_width = 8;
+
+// The control bytes of a group, as a 64-bit word with the first byte in the
+// lowest bits. The result of each `match_` function has the highest bit
+// of the byte set for each matching control byte.
+struct hash_group
+{
+  static BOOST_CONSTEXPR_OR_CONST ::std::uint64_t lsbs = 0x0101010101010101ull;
+  static BOOST_CONSTEXPR_OR_CONST ::std::uint64_t msbs = 0x8080808080808080ull;
+
+  ::std::uint64_t ctrl_;
+
+  explicit hash_group(hash_ctrl const* p) noexcept : ctrl_(0)
+  {
+    for (::std::size_t i = 0; i != hash_group_width; ++i)
+      ctrl_ |= static_cast< ::std::uint64_t>(p[i]) << (8 * i);
+  }
+
+  // May report false positives, but only for full slots, whose keys are compared anyway.
+  ::std::uint64_t match(hash_ctrl h2) const noexcept
+  {
+    ::std::uint64_t const x = ctrl_ ^ (lsbs * h2);
+    return (x - lsbs) & ~x & msbs;
+  }
+
+  ::std::uint64_t match_empty() const noexcept { return ctrl_ & ~(ctrl_ << 6) & msbs; }
+  ::std::uint64_t match_free() const noexcept { return ctrl_ & msbs; }
+  ::std::uint64_t match_full() const noexcept { return ~ctrl_ & msbs; }
+
+  static ::std::size_t first(::std::uint64_t m) noexcept
+  {
+    return static_cast< ::std::size_t>(::boost::core::countr_zero(m)) / 8;
+  }
+};
+
+inline ::std::uint64_t hash_map_mix(::std::uint64_t h) noexcept
+{
+  h *= 0x9e3779b97f4a7c15ull;
+  return h ^ (h >> 32);
+}
+
+// The open-addressing table shared by `optional_hash_map` and `optional_hash_set`.
+// `KeyOf` extracts the key from a stored `Value`.
+template <class Value, class Key, class KeyOf, class Hash, class Eq>
+class hash_table
+{
+public:
+  typedef ::std::size_t size_type;
+
+  hash_table(Hash const& h, Eq const& eq) : size_(0), tombstones_(0), hash_(h), eq_(eq) {}
+
+  hash_table(hash_table const& rhs) : hash_table(rhs.hash_, rhs.eq_)
+  {
+    allocate(rhs.capacity());
+    for (size_type i = 0; i != rhs.capacity(); ++i)
+      if (rhs.full(i))
+        insert_unique(rhs.hash_of(rhs.key(i)), rhs.slots_[i].value_);
+  }
+
+  hash_table(hash_table&& rhs) noexcept : hash_table(rhs.hash_, rhs.eq_)
+  {
+    swap(rhs);
+  }
+
+  hash_table& operator=(hash_table rhs) noexcept
+  {
+    swap(rhs);
+    return *this;
+  }
+
+  ~hash_table() { destroy_all(); }
+
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return ctrl_.size(); }
+
+  // The number of elements the table can hold before it grows.
+  static size_type max_load(size_type cap) noexcept { return cap - cap / 8; }
+
+  void reserve(size_type n)
+  {
+    if (max_load(capacity()) >= n)
+      return;
+    size_type cap = hash_group_width;
+    while (max_load(cap) < n)
+      cap *= 2;
+    rehash(cap);
+  }
+
+  Value* find(Key const& k)
+  {
+    size_type const i = find_index(k, hash_of(k));
+    return i == npos ? nullptr : &slots_[i].value_;
+  }
+
+  Value const* find(Key const& k) const
+  {
+    size_type const i = find_index(k, hash_of(k));
+    return i == npos ? nullptr : &slots_[i].value_;
+  }
+
+  // Constructs a `Value` from `args` unless an element with key `k` is present.
+  template <class... Args>
+  ::std::pair<Value*, bool> try_emplace(Key const& k, Args&&... args)
+  {
+    ::std::uint64_t const h = hash_of(k);
+    size_type const i = find_index(k, h);
+    if (i != npos)
+      return ::std::pair<Value*, bool>(&slots_[i].value_, false);
+
+    if (size_ + tombstones_ + 1 > max_load(capacity()))
+      rehash(capacity() == 0 ? hash_group_width
+             : size_ + 1 > max_load(capacity()) / 2 ? capacity() * 2 : capacity());
+    return ::std::pair<Value*, bool>(insert_unique(h, optional_detail::forward_<Args>(args)...), true);
+  }
+
+  bool erase(Key const& k)
+  {
+    size_type const i = find_index(k, hash_of(k));
+    if (i == npos)
+      return false;
+    erase_at(i);
+    return true;
+  }
+
+  // Destroys the value in the full slot `i`.
+  void erase_at(size_type i) noexcept
+  {
+    BOOST_ASSERT(full(i));
+    slots_[i].value_.~Value();
+    --size_;
+    // Lookups stop at the first group with an empty slot, so if this
+    // group has one, no probe sequence continues past it.
+    if (hash_group(&ctrl_[i - i % hash_group_width]).match_empty() != 0)
+      ctrl_[i] = ctrl_empty;
+    else
+    {
+      ctrl_[i] = ctrl_deleted;
+      ++tombstones_;
+    }
+  }
+
+  void clear() noexcept
+  {
+    destroy_all();
+    ::std::fill(ctrl_.begin(), ctrl_.end(), ctrl_empty);
+    size_ = 0;
+    tombstones_ = 0;
+  }
+
+  // The value in slot `i`, or null if the slot is free.
+  Value* at_slot(size_type i) noexcept
+  {
+    BOOST_ASSERT(i < capacity());
+    return full(i) ? &slots_[i].value_ : nullptr;
+  }
+
+  template <class F>
+  void for_each(F& f)
+  {
+    for (size_type g = 0; g < capacity(); g += hash_group_width)
+      for (::std::uint64_t m = hash_group(&ctrl_[g]).match_full(); m != 0; m &= m - 1)
+        f(slots_[g + hash_group::first(m)].value_);
+  }
+
+  template <class F>
+  void for_each(F& f) const
+  {
+    for (size_type g = 0; g < capacity(); g += hash_group_width)
+      for (::std::uint64_t m = hash_group(&ctrl_[g]).match_full(); m != 0; m &= m - 1)
+        f(static_cast<Value const&>(slots_[g + hash_group::first(m)].value_));
+  }
+
+  void swap(hash_table& rhs) noexcept
+  {
+    using ::std::swap;
+    ctrl_.swap(rhs.ctrl_);
+    slots_.swap(rhs.slots_);
+    swap(size_, rhs.size_);
+    swap(tombstones_, rhs.tombstones_);
+    swap(hash_, rhs.hash_);
+    swap(eq_, rhs.eq_);
+  }
+
+private:
+  static BOOST_CONSTEXPR_OR_CONST size_type npos = static_cast<size_type>(-1);
+
+  ::std::uint64_t hash_of(Key const& k) const
+  {
+    return hash_map_mix(static_cast< ::std::uint64_t>(hash_(k)));
+  }
+
+  static hash_ctrl h2(::std::uint64_t h) noexcept { return static_cast<hash_ctrl>(h & 0x7f); }
+
+  bool full(size_type i) const noexcept { return ctrl_[i] < ctrl_empty; }
+
+  Key const& key(size_type i) const noexcept { return KeyOf()(slots_[i].value_); }
+
+  // Visits the groups in the order 0, 1, 3, 6, ... (modulo the number of groups),
+  // which covers all of them when their number is a power of 2.
+  struct probe_seq
+  {
+    size_type mask_;
+    size_type group_;
+    size_type step_;
+
+    size_type offset() const noexcept { return group_ * hash_group_width; }
+    void next() noexcept { group_ = (group_ + ++step_) & mask_; }
+  };
+
+  probe_seq probe(::std::uint64_t h) const noexcept
+  {
+    size_type const mask = capacity() / hash_group_width - 1;
+    probe_seq const p = { mask, static_cast<size_type>(h >> 7) & mask, 0 };
+    return p;
+  }
+
+  size_type find_index(Key const& k, ::std::uint64_t h) const
+  {
+    if (size_ == 0)
+      return npos;
+    for (probe_seq p = probe(h);; p.next())
+    {
+      hash_group const g(&ctrl_[p.offset()]);
+      for (::std::uint64_t m = g.match(h2(h)); m != 0; m &= m - 1)
+      {
+        size_type const i = p.offset() + hash_group::first(m);
+        if (eq_(key(i), k))
+          return i;
+      }
+      if (g.match_empty() != 0)
+        return npos;
+    }
+  }
+
+  // Constructs a value in the first free slot of the probe sequence of `h`;
+  // the key must not be present and the table must not be full.
+  template <class... Args>
+  Value* insert_unique(::std::uint64_t h, Args&&... args)
+  {
+    probe_seq p = probe(h);
+    ::std::uint64_t m;
+    while ((m = hash_group(&ctrl_[p.offset()]).match_free()) == 0)
+      p.next();
+
+    size_type const i = p.offset() + hash_group::first(m);
+    ::new (static_cast<void*>(&slots_[i].value_)) Value(optional_detail::forward_<Args>(args)...);
+    if (ctrl_[i] == ctrl_deleted)
+      --tombstones_;
+    ctrl_[i] = h2(h);
+    ++size_;
+    return &slots_[i].value_;
+  }
+
+  void allocate(size_type cap)
+  {
+    BOOST_ASSERT(size_ == 0 && cap % hash_group_width == 0);
+    ::std::vector<hash_slot<Value> >(cap).swap(slots_);
+    ctrl_.assign(cap, ctrl_empty);
+  }
+
+  // Moves the elements to a table of capacity `cap`. Elements whose move
+  // may throw are copied, so that an exception leaves `*this` unchanged.
+  void rehash(size_type cap)
+  {
+    hash_table tmp(hash_, eq_);
+    tmp.allocate(cap);
+    for (size_type i = 0; i != capacity(); ++i)
+      if (full(i))
+        tmp.insert_unique(hash_of(key(i)), ::std::move_if_noexcept(slots_[i].value_));
+    swap(tmp);
+  }
+
+  void destroy_all() noexcept
+  {
+    for (size_type i = 0; i != capacity(); ++i)
+      if (full(i))
+        slots_[i].value_.~Value();
+  }
+
+  ::std::vector<hash_ctrl> ctrl_;
+  ::std::vector<hash_slot<Value> > slots_;
+  size_type size_;
+  size_type tombstones_;
+  Hash hash_;
+  Eq eq_;
+};
+
+struct hash_key_of_pair
+{
+  template <class K, class V>
+  K const& operator()(::std::pair<K, V> const& p) const noexcept { return p.first; }
+};
+
+struct hash_key_of_self
+{
+  template <class K>
+  K const& operator()(K const& k) const noexcept { return k; }
+};
+
+template <class F>
+struct hash_map_visitor
+{
+  F& f_;
+
+  template <class K, class V>
+  void operator()(::std::pair<K, V>& p) const { f_(static_cast<K const&>(p.first), p.second); }
+
+  template <class K, class V>
+  void operator()(::std::pair<K, V> const& p) const { f_(p.first, p.second); }
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A hash map with open addressing, storing the elements in place in
+    an array of slots and their presence in a separate array of control
+    bytes, one per slot. Lookups return `optional<V&>`.
+
+    Pointers and references to the elements are invalidated by insertions
+    that grow the table.
+ */
+template <class K, class V, class Hash = ::std::hash<K>, class Eq = ::std::equal_to<K> >
+class optional_hash_map
+{
+  typedef optional_detail::hash_table< ::std::pair<K, V>, K, optional_detail::hash_key_of_pair, Hash, Eq> table_type;
+
+public:
+  typedef K key_type;
+  typedef V mapped_type;
+  typedef ::std::size_t size_type;
+
+  explicit optional_hash_map(Hash const& h = Hash(), Eq const& eq = Eq()) : table_(h, eq) {}
+
+  size_type size() const noexcept { return table_.size(); }
+  bool empty() const noexcept { return table_.size() == 0; }
+  size_type capacity() const noexcept { return table_.capacity(); }
+
+  // Makes room for `n` elements without further growth.
+  void reserve(size_type n) { table_.reserve(n); }
+
+  optional<V&> find(K const& k)
+  {
+    ::std::pair<K, V>* p = table_.find(k);
+    return p ? optional<V&>(p->second) : optional<V&>();
+  }
+
+  optional<V const&> find(K const& k) const
+  {
+    ::std::pair<K, V> const* p = table_.find(k);
+    return p ? optional<V const&>(p->second) : optional<V const&>();
+  }
+
+  bool contains(K const& k) const { return table_.find(k) != nullptr; }
+
+  // Constructs the value from `args` if `k` is not present. Returns
+  // the value with key `k` and whether it has been inserted.
+  template <class... Args>
+  ::std::pair<V&, bool> try_emplace(K const& k, Args&&... args)
+  {
+    ::std::pair< ::std::pair<K, V>*, bool> const r = table_.try_emplace(k, ::std::piecewise_construct,
+      ::std::forward_as_tuple(k), ::std::forward_as_tuple(optional_detail::forward_<Args>(args)...));
+    return ::std::pair<V&, bool>(r.first->second, r.second);
+  }
+
+  bool insert(K const& k, V const& v) { return try_emplace(k, v).second; }
+  bool insert(K const& k, V&& v) { return try_emplace(k, optional_detail::move_(v)).second; }
+
+  V& operator[](K const& k) { return try_emplace(k).first; }
+
+  bool erase(K const& k) { return table_.erase(k); }
+  void clear() noexcept { table_.clear(); }
+
+  // Calls `f(k, v)` for every element, in an unspecified order.
+  template <class F>
+  void for_each(F f)
+  {
+    optional_detail::hash_map_visitor<F> v = { f };
+    table_.for_each(v);
+  }
+
+  template <class F>
+  void for_each(F f) const
+  {
+    optional_detail::hash_map_visitor<F> v = { f };
+    table_.for_each(v);
+  }
+
+  void swap(optional_hash_map& rhs) noexcept { table_.swap(rhs.table_); }
+
+private:
+  table_type table_;
+};
+
+/** A hash set with the layout of `optional_hash_map`. Lookups return
+    `optional<K const&>`.
+ */
+template <class K, class Hash = ::std::hash<K>, class Eq = ::std::equal_to<K> >
+class optional_hash_set
+{
+  typedef optional_detail::hash_table<K, K, optional_detail::hash_key_of_self, Hash, Eq> table_type;
+
+public:
+  typedef K key_type;
+  typedef K value_type;
+  typedef ::std::size_t size_type;
+
+  explicit optional_hash_set(Hash const& h = Hash(), Eq const& eq = Eq()) : table_(h, eq) {}
+
+  size_type size() const noexcept { return table_.size(); }
+  bool empty() const noexcept { return table_.size() == 0; }
+  size_type capacity() const noexcept { return table_.capacity(); }
+
+  void reserve(size_type n) { table_.reserve(n); }
+
+  optional<K const&> find(K const& k) const
+  {
+    K const* p = table_.find(k);
+    return p ? optional<K const&>(*p) : optional<K const&>();
+  }
+
+  bool contains(K const& k) const { return table_.find(k) != nullptr; }
+
+  // Returns true if `k` has been inserted, false if it was already present.
+  bool insert(K const& k) { return table_.try_emplace(k, k).second; }
+  bool insert(K&& k) { return table_.try_emplace(k, optional_detail::move_(k)).second; }
+
+  bool erase(K const& k) { return table_.erase(k); }
+  void clear() noexcept { table_.clear(); }
+
+  // Calls `f(k)` for every element, in an unspecified order.
+  template <class F>
+  void for_each(F f) const { table_.for_each(f); }
+
+  void swap(optional_hash_set& rhs) noexcept { table_.swap(rhs.table_); }
+
+private:
+  table_type table_;
+};
+
+template <class K, class V, class Hash, class Eq>
+inline void swap(optional_hash_map<K, V, Hash, Eq>& lhs, optional_hash_map<K, V, Hash, Eq>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+template <class K, class Hash, class Eq>
+inline void swap(optional_hash_set<K, Hash, Eq>& lhs, optional_hash_set<K, Hash, Eq>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+} // namespace boost
+
+#endif // header guard
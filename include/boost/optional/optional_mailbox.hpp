@@ -0,0 +1,134 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_MAILBOX_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_MAILBOX_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <boost/optional/optional.hpp>
+#include <boost/optional/optional_once.hpp>
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+namespace boost { namespace optional_detail {
+
+typedef ::std::uint32_t mailbox_state;
+
+BOOST_CONSTEXPR_OR_CONST mailbox_state mailbox_empty = 0;
+BOOST_CONSTEXPR_OR_CONST mailbox_state mailbox_full = 1;
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A slot for handing values of type `T` one at a time from one producer
+    thread to one consumer thread. The producer constructs the value in
+    place in the slot with `try_put()` and the consumer moves it out with
+    `try_take()`, which leaves the slot empty again; neither takes a lock.
+    `put()` and `take()` are the blocking versions, which wait for the slot
+    to become empty or full with `std::atomic::wait` (or by yielding, where
+    the standard library does not provide it).
+
+    The mailbox is aligned to a cache line, so that the state and the value,
+    which the two threads pass between them, share no line with unrelated data.
+ */
+template <class T>
+class alignas(64) optional_mailbox
+{
+public:
+  typedef T value_type;
+
+  optional_mailbox() noexcept : state_(optional_detail::mailbox_empty) {}
+
+  optional_mailbox(optional_mailbox const&) = delete;
+  optional_mailbox& operator=(optional_mailbox const&) = delete;
+
+  ~optional_mailbox()
+  {
+    if (state_.load(::std::memory_order_acquire) == optional_detail::mailbox_full)
+      slot_.value_.~T();
+  }
+
+  bool has_value() const noexcept
+  {
+    return state_.load(::std::memory_order_acquire) == optional_detail::mailbox_full;
+  }
+
+  /** Producer only. Constructs a `T` from `args` in the slot, if it is empty,
+      and returns true. If the constructor throws, the slot remains empty.
+   */
+  template <class... Args>
+  bool try_put(Args&&... args)
+  {
+    if (state_.load(::std::memory_order_acquire) != optional_detail::mailbox_empty)
+      return false;
+    put_unchecked(optional_detail::forward_<Args>(args)...);
+    return true;
+  }
+
+  // Producer only. Waits for the slot to become empty and constructs a `T` from `args` in it.
+  template <class... Args>
+  void put(Args&&... args)
+  {
+    optional_detail::once_wait(state_, optional_detail::mailbox_full);
+    put_unchecked(optional_detail::forward_<Args>(args)...);
+  }
+
+  /** Consumer only. Moves the value out of the slot, if there is one, and
+      empties the slot. If the move constructor throws, the value remains.
+   */
+  optional<T> try_take()
+  {
+    if (state_.load(::std::memory_order_acquire) != optional_detail::mailbox_full)
+      return none;
+    return take_unchecked();
+  }
+
+  // Consumer only. Waits for a value and moves it out of the slot.
+  T take()
+  {
+    optional_detail::once_wait(state_, optional_detail::mailbox_empty);
+    optional<T> r = take_unchecked();
+    return optional_detail::move_(*r);
+  }
+
+private:
+  template <class... Args>
+  void put_unchecked(Args&&... args)
+  {
+    ::new (static_cast<void*>(&slot_.value_)) T(optional_detail::forward_<Args>(args)...);
+    state_.store(optional_detail::mailbox_full, ::std::memory_order_release);
+    optional_detail::once_notify_all(state_);
+  }
+
+  optional<T> take_unchecked()
+  {
+    optional<T> r(optional_detail::move_(slot_.value_));
+    slot_.value_.~T();
+    state_.store(optional_detail::mailbox_empty, ::std::memory_order_release);
+    optional_detail::once_notify_all(state_);
+    return r;
+  }
+
+  ::std::atomic<optional_detail::mailbox_state> state_;
+  optional_detail::once_storage<T> slot_;
+};
+
+} // namespace boost
+
+#endif // BOOST_NO_CXX11_HDR_ATOMIC
+
+#endif // header guard
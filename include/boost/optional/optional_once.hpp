@@ -0,0 +1,179 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_ONCE_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_ONCE_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <boost/optional/optional.hpp>
+#include <atomic>
+#include <new>
+#include <thread>
+
+namespace boost { namespace optional_detail {
+
+template <class T>
+union once_storage
+{
+  unsigned char dummy_;
+  T value_;
+
+  once_storage() noexcept : dummy_() {}
+  ~once_storage() {} // `optional_once` destroys the `T` if needed
+};
+
+// Blocks while `a` holds `old`: with `std::atomic::wait` where the library
+// provides it, by yielding otherwise.
+template <class U>
+inline void once_wait(::std::atomic<U> const& a, U old) noexcept
+{
+#if defined(__cpp_lib_atomic_wait)
+  a.wait(old, ::std::memory_order_acquire);
+#else
+  while (a.load(::std::memory_order_acquire) == old)
+    ::std::this_thread::yield();
+#endif
+}
+
+template <class U>
+inline void once_notify_all(::std::atomic<U>& a) noexcept
+{
+#if defined(__cpp_lib_atomic_wait)
+  a.notify_all();
+#else
+  (void)a;
+#endif
+}
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** An optional that is initialized at most once, by the first of any number
+    of threads that asks for its value, in place of an `optional<T>` guarded
+    by `std::call_once`. The value is constructed directly in the object's
+    own storage, and the state of the object is one atomic byte: once the
+    value is there, reading it costs one acquire load.
+
+    While one thread constructs the value, the others that ask for it wait,
+    blocked in `std::atomic::wait` (or yielding, where the standard library
+    does not provide it). If the construction throws, the object is left
+    empty and the next call to `get_or_init()`, possibly one of the waiting
+    ones, tries again.
+ */
+template <class T>
+class optional_once
+{
+  enum state_type : unsigned char { empty_state, busy_state, ready_state };
+
+public:
+  typedef T value_type;
+
+  optional_once() noexcept : state_(empty_state) {}
+
+  optional_once(optional_once const&) = delete;
+  optional_once& operator=(optional_once const&) = delete;
+
+  ~optional_once()
+  {
+    if (state_.load(::std::memory_order_relaxed) == ready_state)
+      storage_.value_.~T();
+  }
+
+  bool has_value() const noexcept
+  {
+    return state_.load(::std::memory_order_acquire) == ready_state;
+  }
+
+  // The value, if it has been initialized.
+  optional<T&> get() noexcept
+  {
+    return has_value() ? optional<T&>(storage_.value_) : optional<T&>();
+  }
+
+  optional<T const&> get() const noexcept
+  {
+    return has_value() ? optional<T const&>(storage_.value_) : optional<T const&>();
+  }
+
+  /** Returns the value, initializing it from `f()` first if no thread has
+      done it yet. `f` is called at most once unless it throws.
+   */
+  template <class F>
+  T& get_or_init(F&& f)
+  {
+    if (state_.load(::std::memory_order_acquire) != ready_state)
+      init_slow(f);
+    return storage_.value_;
+  }
+
+  // Lets a `const` member function initialize a value it caches.
+  template <class F>
+  T const& get_or_init(F&& f) const
+  {
+    if (state_.load(::std::memory_order_acquire) != ready_state)
+      init_slow(f);
+    return storage_.value_;
+  }
+
+private:
+  // Resets the state to empty if the construction of the value throws,
+  // letting the next caller try again.
+  struct init_guard
+  {
+    ::std::atomic<unsigned char>& state_;
+    bool done_;
+
+    ~init_guard()
+    {
+      if (!done_)
+      {
+        state_.store(empty_state, ::std::memory_order_release);
+        optional_detail::once_notify_all(state_);
+      }
+    }
+  };
+
+  template <class F>
+  void init_slow(F& f) const
+  {
+    for (;;)
+    {
+      unsigned char s = empty_state;
+      if (state_.compare_exchange_weak(s, busy_state, ::std::memory_order_acquire, ::std::memory_order_acquire))
+      {
+        init_guard g = { state_, false };
+        ::new (static_cast<void*>(&storage_.value_)) T(f());
+        g.done_ = true;
+        state_.store(ready_state, ::std::memory_order_release);
+        optional_detail::once_notify_all(state_);
+        return;
+      }
+      if (s == ready_state)
+        return;
+      if (s == busy_state)
+        optional_detail::once_wait(state_, static_cast<unsigned char>(busy_state));
+    }
+  }
+
+  mutable ::std::atomic<unsigned char> state_;
+  mutable optional_detail::once_storage<T> storage_;
+};
+
+} // namespace boost
+
+#endif // BOOST_NO_CXX11_HDR_ATOMIC
+
+#endif // header guard
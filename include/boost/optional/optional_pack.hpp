@@ -0,0 +1,312 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_PACK_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_PACK_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/core/launder.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/type_traits/type_with_alignment.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace boost { namespace optional_detail {
+
+template <class... Ts> struct pack_types {};
+
+template < ::std::size_t I, class... Ts> struct pack_type_at;
+
+template <class T, class... Ts>
+struct pack_type_at<0, T, Ts...> { typedef T type; };
+
+template < ::std::size_t I, class T, class... Ts>
+struct pack_type_at<I, T, Ts...> : pack_type_at<I - 1, Ts...> {};
+
+// Field `J` of type `Tj` is placed before field `I` of type `Ti` if it has
+// a stricter alignment, or the same alignment and a lower index. Laying
+// the fields out in this order leaves no padding between them.
+template <class Ti, ::std::size_t I, class Tj, ::std::size_t J>
+struct pack_field_precedes : ::std::integral_constant<bool,
+  (alignof(Tj) > alignof(Ti)) || (alignof(Tj) == alignof(Ti) && J < I)> {};
+
+template <class Ti, ::std::size_t I, ::std::size_t J, class... Ts>
+struct pack_offset : ::std::integral_constant< ::std::size_t, 0> {};
+
+template <class Ti, ::std::size_t I, ::std::size_t J, class Tj, class... Ts>
+struct pack_offset<Ti, I, J, Tj, Ts...> : ::std::integral_constant< ::std::size_t,
+  (pack_field_precedes<Ti, I, Tj, J>::value ? sizeof(Tj) : 0) + pack_offset<Ti, I, J + 1, Ts...>::value> {};
+
+template <class... Ts>
+struct pack_size : ::std::integral_constant< ::std::size_t, 0> {};
+
+template <class T, class... Ts>
+struct pack_size<T, Ts...> : ::std::integral_constant< ::std::size_t, sizeof(T) + pack_size<Ts...>::value> {};
+
+template <class... Ts>
+struct pack_align : ::std::integral_constant< ::std::size_t, 1> {};
+
+template <class T, class... Ts>
+struct pack_align<T, Ts...> : ::std::integral_constant< ::std::size_t,
+  (alignof(T) > pack_align<Ts...>::value ? alignof(T) : pack_align<Ts...>::value)> {};
+
+template <class... Ts>
+struct pack_all_nothrow_move : ::std::true_type {};
+
+template <class T, class... Ts>
+struct pack_all_nothrow_move<T, Ts...> : ::std::integral_constant<bool,
+  ::std::is_nothrow_move_constructible<T>::value && ::std::is_nothrow_move_assignable<T>::value &&
+  pack_all_nothrow_move<Ts...>::value> {};
+
+// The smallest unsigned type with at least `N` bits.
+template < ::std::size_t N>
+struct pack_mask_type
+{
+  static_assert(N <= 64, "optional_pack supports at most 64 fields");
+  typedef typename ::std::conditional<(N <= 8), ::std::uint8_t,
+          typename ::std::conditional<(N <= 16), ::std::uint16_t,
+          typename ::std::conditional<(N <= 32), ::std::uint32_t, ::std::uint64_t>::type>::type>::type type;
+};
+
+template <class Mask, ::std::size_t... Is>
+struct pack_mask : ::std::integral_constant<Mask, 0> {};
+
+template <class Mask, ::std::size_t I, ::std::size_t... Is>
+struct pack_mask<Mask, I, Is...> : ::std::integral_constant<Mask,
+  static_cast<Mask>((Mask(1) << I) | pack_mask<Mask, Is...>::value)> {};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A record of `sizeof...(Ts)` optional fields that share one presence
+    bitmask. The values are stored in a single buffer, ordered by decreasing
+    alignment, so that there is no padding between them; a struct of
+    `optional<Ts>...` pays for a separate flag and its padding per field.
+
+    Field `I` is accessed as `optional<T&>` by `get<I>()`. The presence of
+    several fields can be tested at once with `has_all<Is...>()` and
+    `has_any<Is...>()`, or by comparing `mask()` to `field_mask<Is...>()`.
+ */
+template <class... Ts>
+class optional_pack
+{
+  static_assert(sizeof...(Ts) > 0, "optional_pack requires at least one field");
+
+public:
+  typedef typename optional_detail::pack_mask_type<sizeof...(Ts)>::type mask_type;
+
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t field_count = sizeof...(Ts);
+
+  template < ::std::size_t I>
+  struct field_type : optional_detail::pack_type_at<I, Ts...> {};
+
+  // The offset of field `I` within the value buffer.
+  template < ::std::size_t I>
+  static constexpr ::std::size_t offset() noexcept
+  {
+    return optional_detail::pack_offset<typename field_type<I>::type, I, 0, Ts...>::value;
+  }
+
+  // The mask with the bits of fields `Is...` set.
+  template < ::std::size_t... Is>
+  static constexpr mask_type field_mask() noexcept
+  {
+    return optional_detail::pack_mask<mask_type, Is...>::value;
+  }
+
+  optional_pack() noexcept : mask_(0) {}
+
+  optional_pack(optional_pack const& rhs) : optional_pack()
+  {
+    assign_from(rhs, field<0>());
+  }
+
+  optional_pack(optional_pack&& rhs) noexcept(optional_detail::pack_all_nothrow_move<Ts...>::value)
+    : optional_pack()
+  {
+    assign_from(optional_detail::move_(rhs), field<0>());
+  }
+
+  optional_pack& operator=(optional_pack const& rhs)
+  {
+    assign_from(rhs, field<0>());
+    return *this;
+  }
+
+  optional_pack& operator=(optional_pack&& rhs) noexcept(optional_detail::pack_all_nothrow_move<Ts...>::value)
+  {
+    assign_from(optional_detail::move_(rhs), field<0>());
+    return *this;
+  }
+
+  ~optional_pack() { reset(); }
+
+  // The presence bits of all the fields; bit `I` is set if field `I` has a value.
+  mask_type mask() const noexcept { return mask_; }
+
+  template < ::std::size_t I>
+  bool has() const noexcept { return (mask_ >> I) & 1u; }
+
+  template < ::std::size_t... Is>
+  bool has_all() const noexcept { return (mask_ & field_mask<Is...>()) == field_mask<Is...>(); }
+
+  template < ::std::size_t... Is>
+  bool has_any() const noexcept { return (mask_ & field_mask<Is...>()) != 0; }
+
+  template < ::std::size_t I>
+  optional<typename field_type<I>::type&> get() noexcept
+  {
+    typedef optional<typename field_type<I>::type&> result;
+    return has<I>() ? result(*ptr<I>()) : result();
+  }
+
+  template < ::std::size_t I>
+  optional<typename field_type<I>::type const&> get() const noexcept
+  {
+    typedef optional<typename field_type<I>::type const&> result;
+    return has<I>() ? result(*ptr<I>()) : result();
+  }
+
+  // Destroys the value of field `I`, if any, and constructs a new one from `args`.
+  template < ::std::size_t I, class... Args>
+  typename field_type<I>::type& emplace(Args&&... args)
+  {
+    typedef typename field_type<I>::type T;
+    reset<I>();
+    ::new (address<I>()) T(optional_detail::forward_<Args>(args)...);
+    mask_ |= field_mask<I>();
+    return *ptr<I>();
+  }
+
+  // Assigns `v` to field `I`, or constructs the value from `v` if it has none.
+  template < ::std::size_t I, class U>
+  typename ::std::enable_if<!::std::is_same<typename ::std::decay<U>::type,
+                                            optional<typename field_type<I>::type> >::value>::type
+  set(U&& v)
+  {
+    if (has<I>())
+      *ptr<I>() = optional_detail::forward_<U>(v);
+    else
+      emplace<I>(optional_detail::forward_<U>(v));
+  }
+
+  template < ::std::size_t I>
+  void set(none_t) noexcept
+  {
+    reset<I>();
+  }
+
+  // Assigns the value of `v` to field `I`, or resets it if `v` is empty.
+  template < ::std::size_t I>
+  void set(optional<typename field_type<I>::type> const& v)
+  {
+    if (v)
+      set<I>(*v);
+    else
+      reset<I>();
+  }
+
+  template < ::std::size_t I>
+  void set(optional<typename field_type<I>::type>&& v)
+  {
+    if (v)
+      set<I>(optional_detail::move_(*v));
+    else
+      reset<I>();
+  }
+
+  template < ::std::size_t I>
+  void reset() noexcept
+  {
+    typedef typename field_type<I>::type T;
+    if (has<I>())
+    {
+      ptr<I>()->~T();
+      mask_ &= static_cast<mask_type>(~field_mask<I>());
+    }
+  }
+
+  // Resets all the fields.
+  void reset() noexcept
+  {
+    if (mask_ != 0)
+      reset_from(field<0>());
+  }
+
+private:
+  template < ::std::size_t I>
+  struct field : ::std::integral_constant< ::std::size_t, I> {};
+
+  typedef field<sizeof...(Ts)> field_end;
+
+  template < ::std::size_t I>
+  void* address() noexcept { return storage_.data_ + offset<I>(); }
+
+  template < ::std::size_t I>
+  typename field_type<I>::type* ptr() noexcept
+  {
+    return ::boost::core::launder(static_cast<typename field_type<I>::type*>(address<I>()));
+  }
+
+  template < ::std::size_t I>
+  typename field_type<I>::type const* ptr() const noexcept
+  {
+    return ::boost::core::launder(static_cast<typename field_type<I>::type const*>(
+      static_cast<void const*>(storage_.data_ + offset<I>())));
+  }
+
+  void reset_from(field_end) noexcept {}
+
+  template < ::std::size_t I>
+  void reset_from(field<I>) noexcept
+  {
+    reset<I>();
+    reset_from(field<I + 1>());
+  }
+
+  void assign_from(optional_pack const&, field_end) {}
+  void assign_from(optional_pack&&, field_end) {}
+
+  template < ::std::size_t I>
+  void assign_from(optional_pack const& rhs, field<I>)
+  {
+    if (rhs.has<I>())
+      set<I>(*rhs.ptr<I>());
+    else
+      reset<I>();
+    assign_from(rhs, field<I + 1>());
+  }
+
+  template < ::std::size_t I>
+  void assign_from(optional_pack&& rhs, field<I>)
+  {
+    if (rhs.has<I>())
+      set<I>(optional_detail::move_(*rhs.ptr<I>()));
+    else
+      reset<I>();
+    assign_from(optional_detail::move_(rhs), field<I + 1>());
+  }
+
+  union
+  {
+    unsigned char data_[optional_detail::pack_size<Ts...>::value];
+    typename type_with_alignment<optional_detail::pack_align<Ts...>::value>::type aligner_;
+  } storage_;
+  mask_type mask_;
+};
+
+} // namespace boost
+
+#endif // header guard
@@ -0,0 +1,369 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides parallel algorithms over the present elements of
+// ranges of optionals: `for_each_present()`, `transform_present()`,
+// `reduce_present()`, `transform_reduce_present()` and `count_present_if()`.
+// Each of them takes a `parallel_chunks` policy and either a contiguous
+// array of `optional<T>` or an `optional_bitmap_span<T>`.
+//
+// The range is cut into chunks of a multiple of 64 elements, which the
+// threads take one at a time from a shared counter, so that a thread that
+// finishes its chunks early takes over the remaining ones. In a bitmap
+// span a chunk covers whole words of the bitmap: the threads never write
+// to the same word, and the present elements of a chunk are visited with
+// one `countr_zero` per element rather than a test per position.
+//
+// The functions passed to the algorithms may be called concurrently and in
+// any order. If one of them throws, whether in the calling thread or in
+// another one, the chunks that have not been started are skipped, and the
+// first exception is rethrown in the calling thread once all the threads
+// have stopped; the results written by then remain.
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_PARALLEL_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_PARALLEL_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+
+#include <boost/assert.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/optional/optional_bitmap_span.hpp>
+#include <boost/optional/detail/optional_bitmap.hpp>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace boost {
+
+/** The execution policy of the parallel algorithms over optionals: the
+    number of threads to use, including the calling one (0 for
+    `std::thread::hardware_concurrency()`), and the number of elements in
+    a chunk, the unit of work, rounded up to a multiple of 64.
+    `parallel_chunks(1)` runs the algorithm in the calling thread.
+ */
+struct parallel_chunks
+{
+  unsigned threads;
+  ::std::size_t chunk_size;
+
+  explicit parallel_chunks(unsigned threads = 0, ::std::size_t chunk_size = 16384) noexcept
+    : threads(threads), chunk_size(chunk_size) {}
+};
+
+} // namespace boost
+
+
+namespace boost { namespace optional_detail {
+
+struct chunk_plan
+{
+  ::std::size_t size;
+  ::std::size_t chunk;
+  ::std::size_t count;
+  unsigned threads;
+
+  chunk_plan(parallel_chunks const& p, ::std::size_t n) noexcept : size(n)
+  {
+    ::std::size_t const c = p.chunk_size == 0 ? 1 : p.chunk_size;
+    chunk = (c + bitmap_word_bits - 1) / bitmap_word_bits * bitmap_word_bits;
+    count = (n + chunk - 1) / chunk;
+    unsigned t = p.threads != 0 ? p.threads : ::std::thread::hardware_concurrency();
+    if (t == 0)
+      t = 1;
+    threads = count < t ? static_cast<unsigned>(count) : t;
+  }
+};
+
+// Joins the started threads, also when starting the next one throws, as
+// destroying a joinable `std::thread` would call `std::terminate()`.
+struct thread_joiner
+{
+  ::std::vector< ::std::thread>& threads_;
+
+  ~thread_joiner()
+  {
+    for (::std::size_t t = 0; t != threads_.size(); ++t)
+      threads_[t].join();
+  }
+};
+
+// Calls `body(c, first, last)` for every chunk `c` of the plan, covering
+// the indices `[first, last)`, in `plan.threads` threads. If `body` throws,
+// the remaining chunks are skipped and the first exception is rethrown
+// after the threads have been joined. If a thread cannot be started, the
+// exception propagates once the started ones have taken all the chunks.
+template <class Body>
+void run_chunks(chunk_plan const& plan, Body& body)
+{
+  if (plan.threads <= 1)
+  {
+    for (::std::size_t c = 0; c != plan.count; ++c)
+      body(c, c * plan.chunk, (c + 1) * plan.chunk < plan.size ? (c + 1) * plan.chunk : plan.size);
+    return;
+  }
+
+  ::std::atomic< ::std::size_t> next(0);
+  ::std::atomic<bool> failed(false);
+  ::std::exception_ptr error;
+  auto work = [&plan, &body, &next, &failed, &error]() noexcept
+  {
+    for (;;)
+    {
+      ::std::size_t const c = next.fetch_add(1, ::std::memory_order_relaxed);
+      if (c >= plan.count)
+        return;
+      try
+      {
+        body(c, c * plan.chunk, (c + 1) * plan.chunk < plan.size ? (c + 1) * plan.chunk : plan.size);
+      }
+      catch (...)
+      {
+        if (!failed.exchange(true, ::std::memory_order_relaxed))
+          error = ::std::current_exception();
+        next.store(plan.count, ::std::memory_order_relaxed); // the other threads take no more chunks
+        return;
+      }
+    }
+  };
+
+  {
+    ::std::vector< ::std::thread> helpers;
+    helpers.reserve(plan.threads - 1);
+    thread_joiner const joiner = { helpers };
+    for (unsigned t = 1; t != plan.threads; ++t)
+      helpers.push_back(::std::thread(work));
+    work();
+  }
+  if (error)
+    ::std::rethrow_exception(error);
+}
+
+// Calls `f(i)` for every index `i` in `[first, last)` whose bit is set.
+template <class Word, class F>
+inline void for_each_set_bit(Word const* bits, ::std::size_t first, ::std::size_t last, F&& f)
+{
+  for (::std::size_t w = first / bitmap_word_bits; w * bitmap_word_bits < last; ++w)
+    for (bitmap_word m = bits[w] & bitmap_valid_mask(w, last); m != 0; m &= m - 1)
+      f(w * bitmap_word_bits + static_cast< ::std::size_t>(::boost::core::countr_zero(m)));
+}
+
+// Combines the results of the transformation of the present elements of
+// each chunk, then the results of the chunks, in order, starting from `init`.
+template <class R, class Reduce>
+class chunk_reducer
+{
+public:
+  chunk_reducer(::std::size_t chunks, Reduce& reduce) : partial_(chunks), reduce_(reduce) {}
+
+  template <class U>
+  void add(optional<R>& acc, U&& v) const
+  {
+    if (acc)
+      *acc = reduce_(optional_detail::move_(*acc), optional_detail::forward_<U>(v));
+    else
+      acc.emplace(optional_detail::forward_<U>(v));
+  }
+
+  void store(::std::size_t c, optional<R>&& acc) { partial_[c] = optional_detail::move_(acc); }
+
+  R result(R init)
+  {
+    for (::std::size_t c = 0; c != partial_.size(); ++c)
+      if (partial_[c])
+        init = reduce_(optional_detail::move_(init), optional_detail::move_(*partial_[c]));
+    return init;
+  }
+
+private:
+  ::std::vector<optional<R> > partial_;
+  Reduce& reduce_;
+};
+
+struct count_reduce
+{
+  ::std::size_t operator()(::std::size_t a, ::std::size_t b) const noexcept { return a + b; }
+};
+
+struct identity_transform
+{
+  template <class T>
+  T const& operator()(T const& v) const noexcept { return v; }
+};
+
+template <class Pred>
+struct count_transform
+{
+  Pred& pred_;
+
+  template <class T>
+  ::std::size_t operator()(T const& v) const { return pred_(v) ? 1u : 0u; }
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** Calls `f(v)` for the value `v` of every present element of the array
+    `[first, last)`, with references to non-const values for a non-const array.
+ */
+template <class T, class F>
+void for_each_present(parallel_chunks const& policy, optional<T>* first, optional<T>* last, F f)
+{
+  auto body = [first, &f](::std::size_t, ::std::size_t b, ::std::size_t e)
+  {
+    for (::std::size_t i = b; i != e; ++i)
+      if (first[i])
+        f(*first[i]);
+  };
+  optional_detail::run_chunks(optional_detail::chunk_plan(policy, static_cast< ::std::size_t>(last - first)), body);
+}
+
+template <class T, class F>
+void for_each_present(parallel_chunks const& policy, optional<T> const* first, optional<T> const* last, F f)
+{
+  auto body = [first, &f](::std::size_t, ::std::size_t b, ::std::size_t e)
+  {
+    for (::std::size_t i = b; i != e; ++i)
+      if (first[i])
+        f(*first[i]);
+  };
+  optional_detail::run_chunks(optional_detail::chunk_plan(policy, static_cast< ::std::size_t>(last - first)), body);
+}
+
+template <class T, class F>
+void for_each_present(parallel_chunks const& policy, optional_bitmap_span<T> s, F f)
+{
+  auto body = [&s, &f](::std::size_t, ::std::size_t b, ::std::size_t e)
+  {
+    optional_detail::for_each_set_bit(s.bits(), b, e, [&s, &f](::std::size_t i) { f(s.value(i)); });
+  };
+  optional_detail::run_chunks(optional_detail::chunk_plan(policy, s.size()), body);
+}
+
+/** Assigns `f(v)` to `out[i]` for every present element `v` of `[first, last)`
+    at index `i`, and none for every empty one.
+ */
+template <class T, class U, class F>
+optional<U>* transform_present(parallel_chunks const& policy, optional<T> const* first, optional<T> const* last,
+                               optional<U>* out, F f)
+{
+  auto body = [first, out, &f](::std::size_t, ::std::size_t b, ::std::size_t e)
+  {
+    for (::std::size_t i = b; i != e; ++i)
+    {
+      if (first[i])
+        out[i] = f(*first[i]);
+      else
+        out[i] = none;
+    }
+  };
+  ::std::size_t const n = static_cast< ::std::size_t>(last - first);
+  optional_detail::run_chunks(optional_detail::chunk_plan(policy, n), body);
+  return out + n;
+}
+
+/** Copies the validity bitmap of `in` to `out`, which must have the same size,
+    and assigns `f(v)` to the value slot of `out` for every present value `v`
+    of `in`. The value slots of `out` at the empty positions are not modified.
+ */
+template <class T, class U, class F>
+void transform_present(parallel_chunks const& policy, optional_bitmap_span<T> in, optional_bitmap_span<U> out, F f)
+{
+  BOOST_ASSERT(in.size() == out.size());
+  auto body = [&in, &out, &f](::std::size_t, ::std::size_t b, ::std::size_t e)
+  {
+    for (::std::size_t w = b / optional_detail::bitmap_word_bits; w * optional_detail::bitmap_word_bits < e; ++w)
+      out.bits()[w] = in.bits()[w] & optional_detail::bitmap_valid_mask(w, e);
+    optional_detail::for_each_set_bit(in.bits(), b, e, [&in, &out, &f](::std::size_t i) { out.value(i) = f(in.value(i)); });
+  };
+  optional_detail::run_chunks(optional_detail::chunk_plan(policy, in.size()), body);
+}
+
+/** Returns `init` combined with `transform(v)` for every present value `v`
+    of `[first, last)` by `reduce`, which must be associative. The chunks
+    are combined in order, so `reduce` need not be commutative.
+ */
+template <class T, class R, class Reduce, class Transform>
+R transform_reduce_present(parallel_chunks const& policy, optional<T> const* first, optional<T> const* last,
+                           R init, Reduce reduce, Transform transform)
+{
+  optional_detail::chunk_plan const plan(policy, static_cast< ::std::size_t>(last - first));
+  optional_detail::chunk_reducer<R, Reduce> reducer(plan.count, reduce);
+  auto body = [first, &reducer, &transform](::std::size_t c, ::std::size_t b, ::std::size_t e)
+  {
+    optional<R> acc;
+    for (::std::size_t i = b; i != e; ++i)
+      if (first[i])
+        reducer.add(acc, transform(*first[i]));
+    reducer.store(c, optional_detail::move_(acc));
+  };
+  optional_detail::run_chunks(plan, body);
+  return reducer.result(optional_detail::move_(init));
+}
+
+template <class T, class R, class Reduce, class Transform>
+R transform_reduce_present(parallel_chunks const& policy, optional_bitmap_span<T> s,
+                           R init, Reduce reduce, Transform transform)
+{
+  optional_detail::chunk_plan const plan(policy, s.size());
+  optional_detail::chunk_reducer<R, Reduce> reducer(plan.count, reduce);
+  auto body = [&s, &reducer, &transform](::std::size_t c, ::std::size_t b, ::std::size_t e)
+  {
+    optional<R> acc;
+    optional_detail::for_each_set_bit(s.bits(), b, e,
+                                      [&s, &acc, &reducer, &transform](::std::size_t i) { reducer.add(acc, transform(s.value(i))); });
+    reducer.store(c, optional_detail::move_(acc));
+  };
+  optional_detail::run_chunks(plan, body);
+  return reducer.result(optional_detail::move_(init));
+}
+
+// Returns `init` combined with every present value of `[first, last)` by `reduce`.
+template <class T, class R, class Reduce>
+R reduce_present(parallel_chunks const& policy, optional<T> const* first, optional<T> const* last, R init, Reduce reduce)
+{
+  return transform_reduce_present(policy, first, last, optional_detail::move_(init), reduce,
+                                  optional_detail::identity_transform());
+}
+
+template <class T, class R, class Reduce>
+R reduce_present(parallel_chunks const& policy, optional_bitmap_span<T> s, R init, Reduce reduce)
+{
+  return transform_reduce_present(policy, s, optional_detail::move_(init), reduce, optional_detail::identity_transform());
+}
+
+// The number of present values `v` of `[first, last)` for which `pred(v)` is true.
+template <class T, class Pred>
+::std::size_t count_present_if(parallel_chunks const& policy, optional<T> const* first, optional<T> const* last, Pred pred)
+{
+  optional_detail::count_transform<Pred> const t = { pred };
+  return transform_reduce_present(policy, first, last, ::std::size_t(0), optional_detail::count_reduce(), t);
+}
+
+template <class T, class Pred>
+::std::size_t count_present_if(parallel_chunks const& policy, optional_bitmap_span<T> s, Pred pred)
+{
+  optional_detail::count_transform<Pred> const t = { pred };
+  return transform_reduce_present(policy, s, ::std::size_t(0), optional_detail::count_reduce(), t);
+}
+
+} // namespace boost
+
+#endif // BOOST_NO_CXX11_HDR_THREAD, BOOST_NO_CXX11_HDR_ATOMIC
+
+#endif // header guard
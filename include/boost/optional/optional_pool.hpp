@@ -0,0 +1,340 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_POOL_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_POOL_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/core/addressof.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+#include <atomic>
+#endif
+
+namespace boost { namespace optional_detail {
+
+typedef ::std::uint32_t pool_index;
+
+BOOST_CONSTEXPR_OR_CONST pool_index pool_npos = static_cast<pool_index>(-1);
+
+// The storage of a pool slot: a `T` while the slot is acquired,
+// the index of the next free slot while it is free.
+template <class T>
+union pool_slot
+{
+  pool_index next_;
+  T value_;
+
+  pool_slot() noexcept : next_(0) {}
+  ~pool_slot() {} // the pool destroys the `T` if needed
+};
+
+// The storage of a slot of `concurrent_optional_pool`, which keeps its
+// links apart: a thread popping the slot may still read its link after
+// another thread has constructed a `T` in it.
+template <class T>
+union pool_value_slot
+{
+  unsigned char dummy_;
+  T value_;
+
+  pool_value_slot() noexcept : dummy_() {}
+  ~pool_value_slot() {} // the pool destroys the `T` if needed
+};
+
+// The largest capacity of a pool, whose slots have 32-bit indices and
+// `pool_npos` marks the end of the free list.
+BOOST_CONSTEXPR_OR_CONST ::std::size_t pool_max_size = pool_npos;
+
+// Throws `std::length_error` if `n` exceeds `pool_max_size`.
+inline ::std::size_t pool_checked_capacity(::std::size_t n)
+{
+  if (n > pool_max_size)
+    throw_exception(::std::length_error("optional_pool: capacity too large"));
+  return n;
+}
+
+// Links the slots `[0, n)` into a free list in increasing order.
+template <class T>
+pool_index pool_init_free_list(::std::vector<pool_slot<T> >& slots) noexcept
+{
+  pool_index const n = static_cast<pool_index>(slots.size());
+  for (pool_index i = 0; i != n; ++i)
+    slots[i].next_ = i + 1 == n ? pool_npos : i + 1;
+  return n == 0 ? pool_npos : 0;
+}
+
+// Destroys the values in the slots that are not on the free list starting
+// at `head`; `next_of(i)` is the index of the free slot after slot `i`.
+template <class T, class Slot, class NextOf>
+void pool_destroy_acquired(::std::vector<Slot>& slots, pool_index head, NextOf next_of) noexcept
+{
+  ::std::vector<bool> free(slots.size());
+  for (pool_index i = head; i != pool_npos; i = next_of(i))
+    free[i] = true;
+  for (::std::size_t i = 0; i != slots.size(); ++i)
+    if (!free[i])
+      slots[i].value_.~T();
+}
+
+template <class Slot, class T>
+pool_index pool_index_of(::std::vector<Slot> const& slots, T const& v) noexcept
+{
+  // all the members of a union have the address of the union
+  Slot const* s = static_cast<Slot const*>(static_cast<void const*>(::boost::addressof(v)));
+  BOOST_ASSERT(s >= slots.data() && s < slots.data() + slots.size());
+  return static_cast<pool_index>(s - slots.data());
+}
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A pool of a fixed number of slots for objects of type `T`. Like the
+    storage of an empty `optional<T>`, a free slot holds no `T`; its bytes
+    hold the index of the next free slot instead, so the free list needs no
+    memory of its own.
+
+    `acquire()` constructs a `T` in a free slot, in place, and `release()`
+    destroys it and returns the slot to the pool. The objects that have not
+    been released are destroyed by the destructor of the pool.
+ */
+template <class T>
+class optional_pool
+{
+  typedef optional_detail::pool_slot<T> slot_type;
+
+public:
+  typedef T value_type;
+  typedef ::std::size_t size_type;
+
+  // Throws `std::length_error` if `capacity` exceeds `max_size()`.
+  explicit optional_pool(size_type capacity)
+    : slots_(optional_detail::pool_checked_capacity(capacity))
+    , free_head_(optional_detail::pool_init_free_list(slots_)), size_(0) {}
+
+  optional_pool(optional_pool const&) = delete;
+  optional_pool& operator=(optional_pool const&) = delete;
+
+  ~optional_pool()
+  {
+    if (size_ != 0)
+      optional_detail::pool_destroy_acquired<T>(slots_, free_head_, next_of(slots_));
+  }
+
+  size_type capacity() const noexcept { return slots_.size(); }
+
+  static BOOST_CONSTEXPR size_type max_size() noexcept { return optional_detail::pool_max_size; }
+
+  // The number of acquired objects.
+  size_type size() const noexcept { return size_; }
+
+  bool full() const noexcept { return free_head_ == optional_detail::pool_npos; }
+
+  /** Constructs a `T` from `args` in a free slot and returns a reference to it,
+      or returns none if all the slots are taken. If the constructor throws,
+      the slot stays free.
+   */
+  template <class... Args>
+  optional<T&> acquire(Args&&... args)
+  {
+    optional_detail::pool_index const i = free_head_;
+    if (i == optional_detail::pool_npos)
+      return none;
+
+    struct restore_link
+    {
+      slot_type& slot;
+      optional_detail::pool_index next;
+      bool active;
+      ~restore_link() { if (active) slot.next_ = next; }
+    } guard = { slots_[i], slots_[i].next_, true };
+
+    ::new (static_cast<void*>(&slots_[i].value_)) T(optional_detail::forward_<Args>(args)...);
+    guard.active = false;
+    free_head_ = guard.next;
+    ++size_;
+    return optional<T&>(slots_[i].value_);
+  }
+
+  // Destroys `v`, an object acquired from this pool, and frees its slot.
+  void release(T& v) noexcept
+  {
+    optional_detail::pool_index const i = optional_detail::pool_index_of(slots_, v);
+    v.~T();
+    slots_[i].next_ = free_head_;
+    free_head_ = i;
+    --size_;
+  }
+
+  // Returns true if `v` lives in a slot of this pool.
+  bool owns(T const& v) const noexcept
+  {
+    void const* p = ::boost::addressof(v);
+    return !slots_.empty() && p >= static_cast<void const*>(slots_.data())
+                           && p < static_cast<void const*>(slots_.data() + slots_.size());
+  }
+
+private:
+  struct next_of
+  {
+    ::std::vector<slot_type> const& slots;
+
+    explicit next_of(::std::vector<slot_type> const& s) noexcept : slots(s) {}
+
+    optional_detail::pool_index operator()(optional_detail::pool_index i) const noexcept { return slots[i].next_; }
+  };
+
+  ::std::vector<slot_type> slots_;
+  optional_detail::pool_index free_head_;
+  size_type size_;
+};
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+/** A variant of `optional_pool` whose `acquire()` and `release()` can be
+    called concurrently from multiple threads without locks.
+
+    The free list is a stack whose head packs the index of the first free
+    slot with a counter that changes on every update, so that a thread
+    cannot mistake a slot that has been popped and pushed back for the one
+    it read (the ABA problem).
+
+    Unlike in `optional_pool`, the links are not kept in the free slots but
+    in an array of atomic indices of their own: a thread that has read the
+    head may load the link of a slot that another thread has meanwhile
+    popped and constructed a `T` in. It then loads a stale link, which its
+    update of the head rejects, as the counter has changed.
+ */
+template <class T>
+class concurrent_optional_pool
+{
+  typedef ::std::atomic<optional_detail::pool_index> link_type;
+  typedef optional_detail::pool_value_slot<T> slot_type;
+
+public:
+  typedef T value_type;
+  typedef ::std::size_t size_type;
+
+  // Throws `std::length_error` if `capacity` exceeds `max_size()`.
+  explicit concurrent_optional_pool(size_type capacity)
+    : slots_(optional_detail::pool_checked_capacity(capacity)), links_(capacity), head_(init_links(links_)) {}
+
+  concurrent_optional_pool(concurrent_optional_pool const&) = delete;
+  concurrent_optional_pool& operator=(concurrent_optional_pool const&) = delete;
+
+  // Destroys the objects that have not been released; no other thread may use the pool.
+  ~concurrent_optional_pool()
+  {
+    optional_detail::pool_destroy_acquired<T>(slots_, index_of(head_.load(::std::memory_order_acquire)), next_of(links_));
+  }
+
+  size_type capacity() const noexcept { return slots_.size(); }
+
+  static BOOST_CONSTEXPR size_type max_size() noexcept { return optional_detail::pool_max_size; }
+
+  // Constructs a `T` from `args` in a free slot, or returns none if there is none.
+  template <class... Args>
+  optional<T&> acquire(Args&&... args)
+  {
+    ::std::uint64_t h = head_.load(::std::memory_order_acquire);
+    optional_detail::pool_index i;
+    do
+    {
+      i = index_of(h);
+      if (i == optional_detail::pool_npos)
+        return none;
+    }
+    while (!head_.compare_exchange_weak(h, pack(h, links_[i].load(::std::memory_order_relaxed)),
+                                        ::std::memory_order_acquire, ::std::memory_order_acquire));
+
+    struct push_back_slot
+    {
+      concurrent_optional_pool& pool;
+      optional_detail::pool_index index;
+      bool active;
+      ~push_back_slot() { if (active) pool.push(index); }
+    } guard = { *this, i, true };
+
+    ::new (static_cast<void*>(&slots_[i].value_)) T(optional_detail::forward_<Args>(args)...);
+    guard.active = false;
+    return optional<T&>(slots_[i].value_);
+  }
+
+  // Destroys `v`, an object acquired from this pool, and frees its slot.
+  void release(T& v) noexcept
+  {
+    optional_detail::pool_index const i = optional_detail::pool_index_of(slots_, v);
+    v.~T();
+    push(i);
+  }
+
+private:
+  struct next_of
+  {
+    ::std::vector<link_type> const& links;
+
+    explicit next_of(::std::vector<link_type> const& l) noexcept : links(l) {}
+
+    optional_detail::pool_index operator()(optional_detail::pool_index i) const noexcept
+    {
+      return links[i].load(::std::memory_order_relaxed);
+    }
+  };
+
+  // Links all the slots into a free list in increasing order.
+  static ::std::uint64_t init_links(::std::vector<link_type>& links) noexcept
+  {
+    optional_detail::pool_index const n = static_cast<optional_detail::pool_index>(links.size());
+    for (optional_detail::pool_index i = 0; i != n; ++i)
+      links[i].store(i + 1 == n ? optional_detail::pool_npos : i + 1, ::std::memory_order_relaxed);
+    return n == 0 ? optional_detail::pool_npos : 0;
+  }
+
+  static optional_detail::pool_index index_of(::std::uint64_t h) noexcept
+  {
+    return static_cast<optional_detail::pool_index>(h);
+  }
+
+  // The new value of the head `h` pointing to slot `i`, with the counter bumped.
+  static ::std::uint64_t pack(::std::uint64_t h, optional_detail::pool_index i) noexcept
+  {
+    return (((h >> 32) + 1) << 32) | i;
+  }
+
+  // Links the free slot `i` in at the head of the free list.
+  void push(optional_detail::pool_index i) noexcept
+  {
+    ::std::uint64_t h = head_.load(::std::memory_order_relaxed);
+    links_[i].store(index_of(h), ::std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(h, pack(h, i), ::std::memory_order_release, ::std::memory_order_relaxed))
+      links_[i].store(index_of(h), ::std::memory_order_relaxed);
+  }
+
+  ::std::vector<slot_type> slots_;
+  ::std::vector<link_type> links_;
+  ::std::atomic< ::std::uint64_t> head_;
+};
+
+#endif // BOOST_NO_CXX11_HDR_ATOMIC
+
+} // namespace boost
+
+#endif // header guard
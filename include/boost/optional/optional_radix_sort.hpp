@@ -0,0 +1,288 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+//
+//
+// This header provides an order-preserving encoding of `optional<T>`
+// (for integral, enumeration and floating-point `T`s) into fixed-width
+// unsigned keys, and a stable LSD radix sort built on top of it.
+//
+// The encoding preserves the ordering of the relational operators of
+// `optional`: for `x` and `y` of type `optional<T>`, `x < y` implies
+// `encode_radix_key(x) < encode_radix_key(y)`. The presence flag is the
+// most significant component of the key, so that none sorts first. For
+// `T`s of up to 4 bytes the key is an unsigned integer twice the size of
+// `T`, with the presence flag directly above the bits of the value; for
+// 8-byte `T`s it is a `radix_key128`, a pair of 64-bit words, so that no
+// 128-bit integer type is required.
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_RADIX_SORT_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_RADIX_SORT_19OCT2026_HPP
+
+#include <boost/config.hpp>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace optional_detail {
+
+template < ::std::size_t Size> struct unsigned_of_size;
+template <> struct unsigned_of_size<1> { typedef ::std::uint8_t type; };
+template <> struct unsigned_of_size<2> { typedef ::std::uint16_t type; };
+template <> struct unsigned_of_size<4> { typedef ::std::uint32_t type; };
+template <> struct unsigned_of_size<8> { typedef ::std::uint64_t type; };
+
+template <class T, bool IsEnum = ::std::is_enum<T>::value>
+struct radix_underlying
+{
+  typedef T type;
+};
+
+template <class T>
+struct radix_underlying<T, true>
+{
+  typedef typename ::std::underlying_type<T>::type type;
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** Maps the values of type `T` onto unsigned integers of the same size,
+    so that `a < b` implies `encode(a) < encode(b)`, and values that compare
+    equal have equal keys. Specialized for integral, enumeration and
+    IEEE 754 floating-point types.
+ */
+template <class T, class Enable = void>
+struct radix_key_traits;
+
+template <class T>
+struct radix_key_traits<T, typename ::std::enable_if< ::std::is_integral<T>::value || ::std::is_enum<T>::value>::type>
+{
+  typedef typename optional_detail::unsigned_of_size<sizeof(T)>::type key_type;
+
+  static key_type encode(T v) noexcept
+  {
+    typedef typename optional_detail::radix_underlying<T>::type underlying;
+    key_type const k = static_cast<key_type>(static_cast<underlying>(v));
+    // flipping the sign bit maps the signed range onto the unsigned one monotonically
+    return ::std::is_signed<underlying>::value
+         ? static_cast<key_type>(k ^ (key_type(1) << (sizeof(T) * 8 - 1)))
+         : k;
+  }
+};
+
+template <class T>
+struct radix_key_traits<T, typename ::std::enable_if< ::std::is_floating_point<T>::value>::type>
+{
+  static_assert(::std::numeric_limits<T>::is_iec559, "radix keys require IEEE 754 floating-point types");
+  typedef typename optional_detail::unsigned_of_size<sizeof(T)>::type key_type;
+
+  static key_type encode(T v) noexcept
+  {
+    if (v == T(0))
+      v = T(0); // -0.0 == +0.0, so both get the key of +0.0
+    key_type k;
+    ::std::memcpy(&k, &v, sizeof(T));
+    key_type const sign = key_type(1) << (sizeof(T) * 8 - 1);
+    // negative numbers have all bits flipped, positive ones only the sign bit
+    return (k & sign) ? static_cast<key_type>(~k) : static_cast<key_type>(k | sign);
+  }
+};
+
+/** A 128-bit unsigned key as two 64-bit words, compared as the number
+    `high * 2^64 + low`: the key of `optional<T>` for 8-byte `T`s.
+ */
+struct radix_key128
+{
+  ::std::uint64_t high;
+  ::std::uint64_t low;
+};
+
+inline BOOST_CONSTEXPR bool operator==(radix_key128 const& a, radix_key128 const& b) noexcept
+{
+  return a.high == b.high && a.low == b.low;
+}
+
+inline BOOST_CONSTEXPR bool operator<(radix_key128 const& a, radix_key128 const& b) noexcept
+{
+  return a.high < b.high || (a.high == b.high && a.low < b.low);
+}
+
+inline BOOST_CONSTEXPR bool operator!=(radix_key128 const& a, radix_key128 const& b) noexcept { return !(a == b); }
+inline BOOST_CONSTEXPR bool operator>(radix_key128 const& a, radix_key128 const& b) noexcept { return b < a; }
+inline BOOST_CONSTEXPR bool operator<=(radix_key128 const& a, radix_key128 const& b) noexcept { return !(b < a); }
+inline BOOST_CONSTEXPR bool operator>=(radix_key128 const& a, radix_key128 const& b) noexcept { return !(a < b); }
+
+} // namespace boost
+
+
+namespace boost { namespace optional_detail {
+
+template < ::std::size_t Size>
+struct optional_radix_key_of_size
+{
+  typedef typename unsigned_of_size<2 * Size>::type type;
+
+  template <class K>
+  static type make(bool present, K k) noexcept
+  {
+    return present ? static_cast<type>((type(1) << (Size * 8)) | k) : type(0);
+  }
+};
+
+template <>
+struct optional_radix_key_of_size<8>
+{
+  typedef radix_key128 type;
+
+  static type make(bool present, ::std::uint64_t k) noexcept
+  {
+    type const r = { present ? 1u : 0u, present ? k : 0u };
+    return r;
+  }
+};
+
+// Byte `i` of a key, the least significant being byte 0.
+template <class K>
+inline ::std::size_t radix_key_byte(K k, unsigned i) noexcept
+{
+  return static_cast< ::std::size_t>((k >> (i * 8)) & 0xffu);
+}
+
+inline ::std::size_t radix_key_byte(radix_key128 const& k, unsigned i) noexcept
+{
+  return i < 8 ? radix_key_byte(k.low, i) : radix_key_byte(k.high, i - 8);
+}
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** The key of `optional<T>`: an unsigned key twice the size of `T`, with
+    the presence flag placed directly above the bits of the encoded value,
+    so that none compares less than any value. An unsigned integer for
+    `T`s of up to 4 bytes and a `radix_key128` for 8-byte `T`s.
+ */
+template <class T>
+struct optional_radix_key
+{
+  typedef typename radix_key_traits<T>::key_type value_key_type;
+  typedef typename optional_detail::optional_radix_key_of_size<sizeof(value_key_type)>::type type;
+};
+
+template <class T>
+inline typename optional_radix_key<T>::type encode_radix_key(optional<T> const& o) noexcept
+{
+  typedef typename optional_radix_key<T>::value_key_type value_key_type;
+  return optional_detail::optional_radix_key_of_size<sizeof(value_key_type)>::make(
+      o.has_value(), o ? radix_key_traits<T>::encode(*o) : value_key_type(0));
+}
+
+} // namespace boost
+
+
+namespace boost { namespace optional_detail {
+
+// A stable counting-sort pass: moves `src` into `dst` ordered by the digit `digit(*it)`.
+template < ::std::size_t Buckets, class T, class Digit>
+void radix_pass(optional<T>* src, optional<T>* dst, ::std::size_t n, Digit digit)
+{
+  ::std::size_t count[Buckets] = {};
+  for (::std::size_t i = 0; i != n; ++i)
+    ++count[digit(src[i])];
+
+  ::std::size_t pos = 0;
+  for (::std::size_t b = 0; b != Buckets; ++b)
+  {
+    ::std::size_t const c = count[b];
+    count[b] = pos;
+    pos += c;
+  }
+
+  for (::std::size_t i = 0; i != n; ++i)
+    dst[count[digit(src[i])]++] = src[i];
+}
+
+// Byte `byte_` of the key of an element.
+template <class T>
+struct radix_byte_digit
+{
+  unsigned byte_;
+
+  ::std::size_t operator()(optional<T> const& o) const noexcept
+  {
+    return radix_key_byte(encode_radix_key(o), byte_);
+  }
+};
+
+// Returns true if all the elements would land in a single bucket,
+// in which case the pass can be skipped.
+template <class T, class Digit>
+bool radix_pass_is_trivial(optional<T> const* p, ::std::size_t n, Digit digit)
+{
+  for (::std::size_t i = 1; i < n; ++i)
+    if (digit(p[i]) != digit(p[0]))
+      return false;
+  return true;
+}
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** Sorts the random-access range `[first, last)` of `optional<T>` in the
+    ascending order of `optional`'s `operator<`, where `T` is an integral,
+    enumeration or floating-point type. The sort is stable. The digits are
+    the bytes of `encode_radix_key()`: it makes one pass per byte of the
+    value, then one for the byte holding the presence flag (the bytes above
+    it are always 0), skipping the passes where all elements share the
+    digit, and uses a buffer of `last - first` elements.
+ */
+template <class RandomIt>
+void radix_sort_optionals(RandomIt first, RandomIt last)
+{
+  typedef typename ::std::iterator_traits<RandomIt>::value_type optional_type;
+  typedef typename optional_type::value_type T;
+
+  ::std::size_t const n = static_cast< ::std::size_t>(last - first);
+  if (n < 2)
+    return;
+
+  ::std::vector<optional_type> a(first, last), b(n);
+  optional_type* src = a.data();
+  optional_type* dst = b.data();
+
+  for (unsigned byte = 0; byte != sizeof(T) + 1; ++byte)
+  {
+    optional_detail::radix_byte_digit<T> const digit = { byte };
+    if (!optional_detail::radix_pass_is_trivial(src, n, digit))
+    {
+      optional_detail::radix_pass<256>(src, dst, n, digit);
+      ::std::swap(src, dst);
+    }
+  }
+
+  for (::std::size_t i = 0; i != n; ++i, ++first)
+    *first = src[i];
+}
+
+} // namespace boost
+
+#endif // header guard
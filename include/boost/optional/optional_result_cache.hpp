@@ -0,0 +1,257 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_RESULT_CACHE_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_RESULT_CACHE_19OCT2026_HPP
+
+#include <boost/throw_exception.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/optional/optional_hash_map.hpp>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+namespace boost { namespace optional_detail {
+
+template <class K, class V>
+struct cache_positive_entry
+{
+  K key_;
+  V value_;
+  bool referenced_;
+
+  template <class U>
+  cache_positive_entry(K const& k, U&& v) : key_(k), value_(optional_detail::forward_<U>(v)), referenced_(false) {}
+};
+
+template <class K>
+struct cache_negative_entry
+{
+  K key_;
+  bool referenced_;
+
+  explicit cache_negative_entry(K const& k) : key_(k), referenced_(false) {}
+};
+
+struct cache_key_of
+{
+  template <class Entry>
+  auto operator()(Entry const& e) const noexcept -> decltype((e.key_)) { return e.key_; }
+};
+
+// A hash table of at most `capacity` entries that evicts with the CLOCK
+// algorithm: the hand sweeps over the slots of the table, clearing the
+// reference flags of the entries it passes and evicting the first entry
+// whose flag is already clear.
+template <class Entry, class K, class Hash, class Eq>
+class clock_store
+{
+  typedef hash_table<Entry, K, cache_key_of, Hash, Eq> table_type;
+
+public:
+  typedef ::std::size_t size_type;
+
+  clock_store(size_type capacity, Hash const& h, Eq const& eq)
+    : table_(h, eq), capacity_(capacity), hand_(0)
+  {
+    table_.reserve(capacity);
+  }
+
+  size_type size() const noexcept { return table_.size(); }
+  size_type capacity() const noexcept { return capacity_; }
+
+  Entry* find(K const& k) { return table_.find(k); }
+
+  // Inserts an entry for `k`, which must not be present, evicting another
+  // entry if the store is full. Returns null if the capacity is 0.
+  template <class... Args>
+  Entry* insert(K const& k, Args&&... args)
+  {
+    if (capacity_ == 0)
+      return nullptr;
+    if (table_.size() == capacity_)
+      evict_one();
+    return table_.try_emplace(k, k, optional_detail::forward_<Args>(args)...).first;
+  }
+
+  bool erase(K const& k) { return table_.erase(k); }
+  void clear() noexcept { table_.clear(); }
+
+private:
+  void evict_one() noexcept
+  {
+    for (;;)
+    {
+      size_type const i = hand_ % table_.capacity();
+      hand_ = i + 1;
+      if (Entry* e = table_.at_slot(i))
+      {
+        if (!e->referenced_)
+        {
+          table_.erase_at(i);
+          return;
+        }
+        e->referenced_ = false;
+      }
+    }
+  }
+
+  table_type table_;
+  size_type capacity_;
+  size_type hand_;
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A bounded cache of the results of a lookup that may find nothing,
+    remembering the negative results as well as the positive ones.
+
+    The two kinds of results are kept apart: the positive results in a table
+    of keys and values, the negative results in a table of keys only, so that
+    a cached miss does not pay for the storage of a value. Each table has its
+    own capacity and is evicted with the CLOCK algorithm, an approximation of
+    LRU that costs one flag per entry.
+
+    `find()` returns none if the key is not cached, an engaged
+    `optional<V const&>` for a cached value and an empty one for a cached miss.
+ */
+template <class K, class V, class Hash = ::std::hash<K>, class Eq = ::std::equal_to<K> >
+class optional_result_cache
+{
+public:
+  typedef K key_type;
+  typedef V value_type;
+  typedef ::std::size_t size_type;
+
+  /** Throws `std::invalid_argument` if `positive_capacity` is 0, as
+      `find_or_load()` returns a reference to the cached value. The
+      capacity for misses may be 0, in which case misses are not cached.
+   */
+  optional_result_cache(size_type positive_capacity, size_type negative_capacity,
+                        Hash const& h = Hash(), Eq const& eq = Eq())
+    : positive_(checked_capacity(positive_capacity), h, eq), negative_(negative_capacity, h, eq) {}
+
+  size_type size() const noexcept { return positive_.size() + negative_.size(); }
+  bool empty() const noexcept { return size() == 0; }
+
+  // The number of cached values.
+  size_type positive_size() const noexcept { return positive_.size(); }
+
+  // The number of cached misses.
+  size_type negative_size() const noexcept { return negative_.size(); }
+
+  /** Looks up `k` and marks its entry as recently used. The reference to
+      the value is invalidated by the next insertion.
+   */
+  optional<optional<V const&> > find(K const& k)
+  {
+    typedef optional<optional<V const&> > result_type;
+    if (positive_entry* p = positive_.find(k))
+    {
+      p->referenced_ = true;
+      return result_type(in_place_init, p->value_);
+    }
+    if (negative_entry* n = negative_.find(k))
+    {
+      n->referenced_ = true;
+      return result_type(in_place_init);
+    }
+    return result_type();
+  }
+
+  // Records `v` as the result for `k`, replacing the previous result, if any.
+  void insert(K const& k, V const& v) { insert_value(k, v); }
+  void insert(K const& k, V&& v) { insert_value(k, optional_detail::move_(v)); }
+
+  // Records that there is no value for `k`.
+  void insert(K const& k, none_t)
+  {
+    positive_.erase(k);
+    if (!negative_.find(k))
+      negative_.insert(k);
+  }
+
+  void insert(K const& k, optional<V> const& v)
+  {
+    if (v)
+      insert_value(k, *v);
+    else
+      insert(k, none);
+  }
+
+  void insert(K const& k, optional<V>&& v)
+  {
+    if (v)
+      insert_value(k, optional_detail::move_(*v));
+    else
+      insert(k, none);
+  }
+
+  /** Returns the cached result for `k`, or calls `load(k)`, which returns
+      `optional<V>`, caches its result and returns it.
+   */
+  template <class F>
+  optional<V const&> find_or_load(K const& k, F load)
+  {
+    optional<optional<V const&> > const r = find(k);
+    if (r)
+      return *r;
+
+    optional<V> v = load(k);
+    if (!v)
+    {
+      insert(k, none);
+      return none;
+    }
+    return optional<V const&>(insert_value(k, optional_detail::move_(*v))->value_);
+  }
+
+  bool erase(K const& k) { return positive_.erase(k) || negative_.erase(k); }
+
+  void clear() noexcept
+  {
+    positive_.clear();
+    negative_.clear();
+  }
+
+private:
+  typedef optional_detail::cache_positive_entry<K, V> positive_entry;
+  typedef optional_detail::cache_negative_entry<K> negative_entry;
+
+  static size_type checked_capacity(size_type n)
+  {
+    if (n == 0)
+      throw_exception(::std::invalid_argument("optional_result_cache: zero capacity for values"));
+    return n;
+  }
+
+  template <class U>
+  positive_entry* insert_value(K const& k, U&& v)
+  {
+    if (positive_entry* p = positive_.find(k))
+    {
+      p->value_ = optional_detail::forward_<U>(v);
+      return p;
+    }
+    negative_.erase(k);
+    return positive_.insert(k, optional_detail::forward_<U>(v));
+  }
+
+  optional_detail::clock_store<positive_entry, K, Hash, Eq> positive_;
+  optional_detail::clock_store<negative_entry, K, Hash, Eq> negative_;
+};
+
+} // namespace boost
+
+#endif // header guard
@@ -0,0 +1,256 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_RING_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_RING_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/optional/detail/optional_bitmap.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace boost { namespace optional_detail {
+
+template <class T>
+union ring_slot
+{
+  unsigned char dummy_;
+  T value_;
+
+  ring_slot() noexcept : dummy_() {}
+  ~ring_slot() {} // the ring destroys the `T` if needed
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A window of `N` consecutive positions, each of which may hold a `T`,
+    stored in a circular array of `N` slots. Positions are given relative
+    to the front of the window; `base()` is the number of positions that
+    have left the window through the front, so the absolute position of
+    the element at index `i` is `base() + i`.
+
+    The presence of the values is recorded in a separate bitmap, so that
+    finding the next present element, counting the present elements and
+    measuring the run of present elements at the front take one `countr_zero`
+    or `popcount` per 64 positions, instead of testing every slot.
+ */
+template <class T, ::std::size_t N>
+class optional_ring
+{
+  static_assert(N > 0, "optional_ring requires a positive capacity");
+
+  typedef optional_detail::bitmap_word word_type;
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t word_bits = optional_detail::bitmap_word_bits;
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t word_count = (N + word_bits - 1) / word_bits;
+
+public:
+  typedef T value_type;
+  typedef ::std::size_t size_type;
+
+  optional_ring() noexcept : head_(0), base_(0), bits_() {}
+
+  optional_ring(optional_ring const& rhs) : optional_ring()
+  {
+    copy_from(rhs);
+  }
+
+  optional_ring& operator=(optional_ring const& rhs)
+  {
+    if (this != &rhs)
+    {
+      clear();
+      copy_from(rhs);
+    }
+    return *this;
+  }
+
+  ~optional_ring() { clear(); }
+
+  static BOOST_CONSTEXPR size_type capacity() noexcept { return N; }
+
+  // The absolute position of the front of the window.
+  ::std::uint64_t base() const noexcept { return base_; }
+
+  bool has_value(size_type i) const noexcept
+  {
+    BOOST_ASSERT(i < N);
+    return optional_detail::bitmap_test(bits_, physical(i));
+  }
+
+  optional<T&> operator[](size_type i) noexcept
+  {
+    return has_value(i) ? optional<T&>(slots_[physical(i)].value_) : optional<T&>();
+  }
+
+  optional<T const&> operator[](size_type i) const noexcept
+  {
+    return has_value(i) ? optional<T const&>(slots_[physical(i)].value_) : optional<T const&>();
+  }
+
+  // Constructs a value at index `i` from `args`, destroying the previous one, if any.
+  template <class... Args>
+  T& emplace(size_type i, Args&&... args)
+  {
+    reset(i);
+    size_type const p = physical(i);
+    ::new (static_cast<void*>(&slots_[p].value_)) T(optional_detail::forward_<Args>(args)...);
+    optional_detail::bitmap_set(bits_, p);
+    return slots_[p].value_;
+  }
+
+  void reset(size_type i) noexcept
+  {
+    size_type const p = physical(i);
+    if (optional_detail::bitmap_test(bits_, p))
+    {
+      slots_[p].value_.~T();
+      optional_detail::bitmap_clear(bits_, p);
+    }
+  }
+
+  // The number of present elements.
+  size_type count() const noexcept { return optional_detail::bitmap_count(bits_, N); }
+
+  // The index of the first present element at or after index `i`, or `N` if there is none.
+  size_type next_present(size_type i) const noexcept { return find(i, 0); }
+
+  // The number of consecutive present elements at the front of the window.
+  size_type front_run() const noexcept { return find(0, ~word_type(0)); }
+
+  /** Passes the elements of the run of present elements at the front of
+      the window, as rvalues, to `f`, destroys them and moves the window
+      past them. Returns the number of elements drained.
+   */
+  template <class F>
+  size_type drain(F f)
+  {
+    size_type const n = front_run();
+    for (size_type k = 0; k != n; ++k)
+    {
+      f(optional_detail::move_(slots_[head_].value_));
+      pop_front();
+    }
+    return n;
+  }
+
+  // Moves the window `n` positions forward, destroying the values that leave it.
+  void advance(size_type n) noexcept
+  {
+    for (size_type k = 0; k != n && k != N; ++k)
+      pop_front();
+    if (n > N)
+    {
+      head_ = (head_ + (n - N)) % N;
+      base_ += n - N;
+    }
+  }
+
+  // Destroys all the values; the window does not move.
+  void clear() noexcept
+  {
+    for (size_type w = 0; w != word_count; ++w)
+      for (word_type m = bits_[w]; m != 0; m &= m - 1)
+        slots_[w * word_bits + static_cast<size_type>(::boost::core::countr_zero(m))].value_.~T();
+    for (size_type w = 0; w != word_count; ++w)
+      bits_[w] = 0;
+  }
+
+private:
+  size_type physical(size_type i) const noexcept
+  {
+    BOOST_ASSERT(i < N);
+    return head_ + i < N ? head_ + i : head_ + i - N;
+  }
+
+  size_type logical(size_type p) const noexcept
+  {
+    return p >= head_ ? p - head_ : p + N - head_;
+  }
+
+  void pop_front() noexcept
+  {
+    if (optional_detail::bitmap_test(bits_, head_))
+    {
+      slots_[head_].value_.~T();
+      optional_detail::bitmap_clear(bits_, head_);
+    }
+    head_ = head_ + 1 == N ? 0 : head_ + 1;
+    ++base_;
+  }
+
+  // The first slot in `[first, last)` whose bit, xor-ed with `flip`, is set, or `last`.
+  size_type find_physical(size_type first, size_type last, word_type flip) const noexcept
+  {
+    if (first >= last)
+      return last;
+    size_type w = first / word_bits;
+    word_type m = (bits_[w] ^ flip) & (~word_type(0) << (first % word_bits));
+    for (;;)
+    {
+      if (m != 0)
+      {
+        size_type const p = w * word_bits + static_cast<size_type>(::boost::core::countr_zero(m));
+        return p < last ? p : last;
+      }
+      if (++w * word_bits >= last)
+        return last;
+      m = bits_[w] ^ flip;
+    }
+  }
+
+  // The first index at or after `i` whose bit, xor-ed with `flip`, is set, or `N`.
+  // The indices from the front of the window map onto the slots `[head_, N)`
+  // followed by `[0, head_)`.
+  size_type find(size_type i, word_type flip) const noexcept
+  {
+    if (i >= N)
+      return N;
+    size_type const p = physical(i);
+    if (p >= head_)
+    {
+      size_type const q = find_physical(p, N, flip);
+      if (q != N)
+        return logical(q);
+      size_type const r = find_physical(0, head_, flip);
+      return r != head_ ? logical(r) : N;
+    }
+    size_type const r = find_physical(p, head_, flip);
+    return r != head_ ? logical(r) : N;
+  }
+
+  void copy_from(optional_ring const& rhs)
+  {
+    head_ = rhs.head_;
+    base_ = rhs.base_;
+    for (size_type w = 0; w != word_count; ++w)
+      for (word_type m = rhs.bits_[w]; m != 0; m &= m - 1)
+      {
+        size_type const p = w * word_bits + static_cast<size_type>(::boost::core::countr_zero(m));
+        ::new (static_cast<void*>(&slots_[p].value_)) T(rhs.slots_[p].value_);
+        optional_detail::bitmap_set(bits_, p);
+      }
+  }
+
+  size_type head_;
+  ::std::uint64_t base_;
+  word_type bits_[word_count];
+  optional_detail::ring_slot<T> slots_[N];
+};
+
+} // namespace boost
+
+#endif // header guard
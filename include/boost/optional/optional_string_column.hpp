@@ -0,0 +1,200 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_STRING_COLUMN_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_STRING_COLUMN_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+
+#include <boost/assert.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/optional/detail/optional_bitmap.hpp>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace boost {
+
+/** A column of optional strings stored in three arrays: a validity bitmap,
+    an array of `size() + 1` offsets and a single buffer holding the
+    characters of all the strings back to back. The `i`-th string occupies
+    the characters in `[offsets()[i], offsets()[i + 1])`; empty elements
+    occupy no characters.
+
+    Elements are accessed as `optional<std::basic_string_view<CharT, Traits>>`,
+    which refer to the internal buffer and are invalidated by appending
+    to the column.
+ */
+template <class CharT, class Traits = ::std::char_traits<CharT> >
+class basic_optional_string_column
+{
+  typedef optional_detail::bitmap_word word_type;
+
+public:
+  typedef ::std::basic_string_view<CharT, Traits> string_view_type;
+  typedef optional<string_view_type> value_type;
+  typedef ::std::size_t size_type;
+
+  basic_optional_string_column() : offsets_(1, 0) {}
+
+  // Builds the column from a range of `optional<string_view_type>`.
+  template <class ForwardIt>
+  basic_optional_string_column(ForwardIt first, ForwardIt last) : offsets_(1, 0)
+  {
+    append(first, last);
+  }
+
+  size_type size() const noexcept { return offsets_.size() - 1; }
+  bool empty() const noexcept { return size() == 0; }
+
+  // The number of elements that have a value.
+  size_type count() const noexcept { return optional_detail::bitmap_count(bits_.data(), size()); }
+
+  // The total number of characters in all the strings.
+  size_type char_count() const noexcept { return chars_.size(); }
+
+  word_type const* bits() const noexcept { return bits_.data(); }
+  size_type const* offsets() const noexcept { return offsets_.data(); }
+  CharT const* chars() const noexcept { return chars_.data(); }
+
+  // Reserves space for `n` elements and `nchars` characters in total.
+  void reserve(size_type n, size_type nchars)
+  {
+    bits_.reserve(optional_detail::bitmap_words(n));
+    offsets_.reserve(n + 1);
+    chars_.reserve(nchars);
+  }
+
+  bool has_value(size_type i) const noexcept
+  {
+    BOOST_ASSERT(i < size());
+    return optional_detail::bitmap_test(bits_.data(), i);
+  }
+
+  value_type operator[](size_type i) const noexcept
+  {
+    return has_value(i) ? value_type(string_at(i)) : value_type();
+  }
+
+  void push_back(none_t)
+  {
+    append_slot(false);
+  }
+
+  void push_back(string_view_type s)
+  {
+    chars_.insert(chars_.end(), s.begin(), s.end());
+    append_slot(true);
+  }
+
+  void push_back(value_type const& o)
+  {
+    if (o)
+      push_back(*o);
+    else
+      push_back(none);
+  }
+
+  /** Appends the range `[first, last)` of elements convertible to
+      `optional<string_view_type>`. The range is traversed twice: first
+      to compute the required capacity, so that each array grows at most
+      once per call. An array that grows at least doubles its capacity,
+      so that appending many small ranges takes amortized linear time.
+   */
+  template <class ForwardIt>
+  void append(ForwardIt first, ForwardIt last)
+  {
+    size_type n = 0, nchars = 0;
+    for (ForwardIt it = first; it != last; ++it, ++n)
+    {
+      value_type const o(*it);
+      if (o)
+        nchars += o->size();
+    }
+    grow(bits_, optional_detail::bitmap_words(size() + n));
+    grow(offsets_, offsets_.size() + n);
+    grow(chars_, chars_.size() + nchars);
+
+    for (; first != last; ++first)
+      push_back(value_type(*first));
+  }
+
+  void clear() noexcept
+  {
+    bits_.clear();
+    offsets_.resize(1);
+    chars_.clear();
+  }
+
+  void swap(basic_optional_string_column& rhs) noexcept
+  {
+    bits_.swap(rhs.bits_);
+    offsets_.swap(rhs.offsets_);
+    chars_.swap(rhs.chars_);
+  }
+
+private:
+  string_view_type string_at(size_type i) const noexcept
+  {
+    return string_view_type(chars_.data() + offsets_[i], offsets_[i + 1] - offsets_[i]);
+  }
+
+  // Ensures room for `required` elements in `v`, at least doubling its capacity if it grows.
+  template <class Vector>
+  static void grow(Vector& v, size_type required)
+  {
+    if (v.capacity() < required)
+      v.reserve(required > 2 * v.capacity() ? required : 2 * v.capacity());
+  }
+
+  // Records a new element whose characters (if any) have already been
+  // appended to `chars_`. If that throws, the characters are discarded.
+  void append_slot(bool has)
+  {
+    size_type const i = size();
+    struct rollback
+    {
+      ::std::vector<CharT>& chars;
+      size_type size;
+      bool active;
+      ~rollback() { if (active) chars.resize(size); }
+    } guard = { chars_, offsets_.back(), true };
+
+    if (bits_.size() < optional_detail::bitmap_words(i + 1))
+      bits_.push_back(0);
+    offsets_.push_back(chars_.size());
+    guard.active = false;
+    optional_detail::bitmap_assign(bits_.data(), i, has);
+  }
+
+  ::std::vector<word_type> bits_;
+  ::std::vector<size_type> offsets_;
+  ::std::vector<CharT> chars_;
+};
+
+typedef basic_optional_string_column<char> optional_string_column;
+typedef basic_optional_string_column<wchar_t> optional_wstring_column;
+
+template <class CharT, class Traits>
+inline void swap(basic_optional_string_column<CharT, Traits>& lhs, basic_optional_string_column<CharT, Traits>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+} // namespace boost
+
+#endif // BOOST_NO_CXX17_HDR_STRING_VIEW
+
+#endif // header guard
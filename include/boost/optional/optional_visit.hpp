@@ -0,0 +1,141 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_OPTIONAL_VISIT_19OCT2026_HPP
+#define BOOST_OPTIONAL_OPTIONAL_VISIT_19OCT2026_HPP
+
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace boost { namespace optional_detail {
+
+template < ::std::size_t... Is> struct index_sequence {};
+
+template <class S1, class S2> struct concat_index_sequence;
+
+template < ::std::size_t... I1, ::std::size_t... I2>
+struct concat_index_sequence<index_sequence<I1...>, index_sequence<I2...> >
+{
+  typedef index_sequence<I1..., (sizeof...(I1) + I2)...> type;
+};
+
+template < ::std::size_t N>
+struct make_index_sequence
+  : concat_index_sequence<typename make_index_sequence<N / 2>::type,
+                          typename make_index_sequence<N - N / 2>::type> {};
+
+template <> struct make_index_sequence<0> { typedef index_sequence<> type; };
+template <> struct make_index_sequence<1> { typedef index_sequence<0> type; };
+
+inline ::std::size_t visit_mask(::std::size_t) noexcept { return 0; }
+
+template <class O, class... Os>
+inline ::std::size_t visit_mask(::std::size_t bit, O const& o, Os const&... os) noexcept
+{
+  return (static_cast< ::std::size_t>(static_cast<bool>(o)) << bit) | visit_mask(bit + 1, os...);
+}
+
+// Produces the argument passed to the visitor for an optional of type `O`:
+// its value if it is present, or `none`.
+template <bool Has>
+struct visit_arg
+{
+  template <class O>
+  static auto get(typename ::std::remove_reference<O>::type& o) -> decltype(*static_cast<O&&>(o))
+  {
+    return *static_cast<O&&>(o);
+  }
+};
+
+template <>
+struct visit_arg<false>
+{
+  template <class O>
+  static none_t get(typename ::std::remove_reference<O>::type&) noexcept
+  {
+    return none;
+  }
+};
+
+template <class R, class F, class Is, class... Os>
+struct visit_table;
+
+template <class R, class F, ::std::size_t... Is, class... Os>
+struct visit_table<R, F, index_sequence<Is...>, Os...>
+{
+  typedef R (*entry_type)(F&, typename ::std::remove_reference<Os>::type&...);
+
+  // The function handling the combination of presence flags `Mask`.
+  template < ::std::size_t Mask>
+  static R call(F& f, typename ::std::remove_reference<Os>::type&... os)
+  {
+    return R(f(visit_arg<((Mask >> Is) & 1u) != 0>::template get<Os>(os)...));
+  }
+
+  template < ::std::size_t... Masks>
+  static entry_type const* entries(index_sequence<Masks...>) noexcept
+  {
+    static entry_type const table[] = { &call<Masks>... };
+    return table;
+  }
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** Calls `f` with one argument per optional in `os...`: the contained value
+    if the optional has one, or `none` otherwise. `f` is expected to be
+    an overload set (or a generic callable) that handles every combination
+    of present and absent arguments.
+
+    Instead of testing the optionals one after another, the presence flags are
+    combined into one bitmask which indexes a table of `2^sizeof...(os)`
+    functions generated at compile time, so there is one indirect call instead
+    of a chain of dependent branches. The result is `f`'s result for the case
+    where all the optionals are present, to which the results of the other
+    cases are converted.
+ */
+template <class F, class... Os>
+auto optional_visit(F&& f, Os&&... os)
+  -> decltype(f(*optional_detail::forward_<Os>(os)...))
+{
+  static_assert(sizeof...(Os) > 0 && sizeof...(Os) <= 8, "optional_visit supports 1 to 8 optionals");
+  typedef decltype(f(*optional_detail::forward_<Os>(os)...)) result_type;
+  typedef typename ::std::remove_reference<F>::type visitor_type;
+  typedef optional_detail::visit_table<result_type, visitor_type,
+    typename optional_detail::make_index_sequence<sizeof...(Os)>::type, Os...> table_type;
+
+  typename table_type::entry_type const* const table =
+    table_type::entries(typename optional_detail::make_index_sequence<(1u << sizeof...(Os))>::type());
+  return table[optional_detail::visit_mask(0, os...)](f, os...);
+}
+
+/** Returns a tuple of references to the values of `os...` if all of them
+    have values, or none otherwise. The presence of all the optionals is
+    checked with a single comparison of their combined presence mask.
+ */
+template <class... Os>
+optional< ::std::tuple<decltype(*::std::declval<Os&>())...> > optional_zip(Os&... os)
+{
+  typedef ::std::tuple<decltype(*::std::declval<Os&>())...> tuple_type;
+  ::std::size_t const all = (::std::size_t(1) << sizeof...(Os)) - 1;
+  return optional_detail::visit_mask(0, os...) == all
+       ? optional<tuple_type>(tuple_type(*os...))
+       : optional<tuple_type>();
+}
+
+} // namespace boost
+
+#endif // header guard
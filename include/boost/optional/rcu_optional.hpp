@@ -0,0 +1,291 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_RCU_OPTIONAL_19OCT2026_HPP
+#define BOOST_OPTIONAL_RCU_OPTIONAL_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/optional/detail/optional_aligned_allocator.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace boost { namespace optional_detail {
+
+// The epoch a reader announces while it is outside of a read.
+BOOST_CONSTEXPR_OR_CONST ::std::uint64_t rcu_quiescent = 0;
+
+// The state of one registered reader, alone in its cache line, so that
+// readers announcing their epochs do not contend with each other.
+struct alignas(64) rcu_reader_slot
+{
+  ::std::atomic< ::std::uint64_t> epoch_;
+  ::std::atomic<bool> in_use_;
+
+  rcu_reader_slot() noexcept : epoch_(rcu_quiescent), in_use_(false) {}
+};
+
+template <class T>
+struct rcu_retired
+{
+  T const* value_;
+  ::std::uint64_t epoch_;
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** An optional `T` that is read often, by many threads, and replaced rarely,
+    with read-copy-update: a writer never modifies the value that readers
+    see, but publishes a new one (or none) and destroys the old one later,
+    once no reader can still be looking at it.
+
+    A thread reads through a `reader`, which claims one of `max_readers`
+    cache-line-sized slots for its lifetime. `reader::read()` returns a
+    `read_guard` that gives access to the value as `optional<T const&>`:
+    entering a read announces the current epoch in the slot of the reader
+    and leaving it marks the slot quiescent, both with plain stores, so
+    readers on different cores share no cache lines and perform no atomic
+    read-modify-write operations.
+
+    Each write retires the previous value with the current epoch and then
+    advances the epoch. A retired value is destroyed by a later write, or
+    by `collect()`, as soon as every reader is either quiescent or has
+    entered its read in a later epoch. Writers are serialized by a mutex.
+ */
+template <class T>
+class rcu_optional
+{
+  typedef optional_detail::rcu_retired<T> retired_type;
+
+public:
+  typedef T value_type;
+  typedef ::std::size_t size_type;
+
+  class reader;
+
+  // Gives access to the value seen on entering the read; the value remains
+  // alive until the guard is destroyed.
+  class read_guard
+  {
+  public:
+    read_guard(read_guard&& rhs) noexcept : reader_(rhs.reader_), value_(rhs.value_)
+    {
+      rhs.reader_ = nullptr;
+    }
+
+    read_guard(read_guard const&) = delete;
+    read_guard& operator=(read_guard const&) = delete;
+
+    ~read_guard()
+    {
+      if (reader_)
+        reader_->leave();
+    }
+
+    optional<T const&> get() const noexcept
+    {
+      return value_ ? optional<T const&>(*value_) : optional<T const&>();
+    }
+
+    bool has_value() const noexcept { return value_ != nullptr; }
+    explicit operator bool() const noexcept { return has_value(); }
+
+    T const& operator*() const noexcept
+    {
+      BOOST_ASSERT(value_);
+      return *value_;
+    }
+
+    T const* operator->() const noexcept
+    {
+      BOOST_ASSERT(value_);
+      return value_;
+    }
+
+  private:
+    friend class reader;
+
+    read_guard(reader* r, T const* v) noexcept : reader_(r), value_(v) {}
+
+    reader* reader_;
+    T const* value_;
+  };
+
+  /** The registration of a reading thread. Not to be shared between threads.
+      Throws `std::length_error` if all the reader slots are taken.
+   */
+  class reader
+  {
+  public:
+    explicit reader(rcu_optional const& o) : owner_(o), slot_(o.claim_slot()), depth_(0) {}
+
+    reader(reader const&) = delete;
+    reader& operator=(reader const&) = delete;
+
+    ~reader()
+    {
+      BOOST_ASSERT(depth_ == 0);
+      slot_.in_use_.store(false, ::std::memory_order_release);
+    }
+
+    // Enters a read; reads may nest.
+    read_guard read() noexcept
+    {
+      if (depth_++ == 0)
+      {
+        slot_.epoch_.store(owner_.epoch_.load(::std::memory_order_relaxed), ::std::memory_order_relaxed);
+        // orders the announcement before the load of the value, as seen by the writers
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+      }
+      return read_guard(this, owner_.value_.load(::std::memory_order_acquire));
+    }
+
+  private:
+    friend class read_guard;
+
+    void leave() noexcept
+    {
+      BOOST_ASSERT(depth_ > 0);
+      if (--depth_ == 0)
+        slot_.epoch_.store(optional_detail::rcu_quiescent, ::std::memory_order_release);
+    }
+
+    rcu_optional const& owner_;
+    optional_detail::rcu_reader_slot& slot_;
+    unsigned depth_;
+  };
+
+  explicit rcu_optional(size_type max_readers = 128)
+    : value_(nullptr), epoch_(1), slots_(max_readers) {}
+
+  explicit rcu_optional(T const& v, size_type max_readers = 128)
+    : value_(new T(v)), epoch_(1), slots_(max_readers) {}
+
+  rcu_optional(rcu_optional const&) = delete;
+  rcu_optional& operator=(rcu_optional const&) = delete;
+
+  // No reader may remain.
+  ~rcu_optional()
+  {
+    delete value_.load(::std::memory_order_acquire);
+    for (::std::size_t i = 0; i != retired_.size(); ++i)
+      delete retired_[i].value_;
+  }
+
+  size_type max_readers() const noexcept { return slots_.size(); }
+
+  // Publishes a new value constructed from `args`.
+  template <class... Args>
+  void emplace(Args&&... args)
+  {
+    publish(new T(optional_detail::forward_<Args>(args)...));
+  }
+
+  void store(optional<T> const& v)
+  {
+    publish(v ? new T(*v) : nullptr);
+  }
+
+  void store(optional<T>&& v)
+  {
+    publish(v ? new T(optional_detail::move_(*v)) : nullptr);
+  }
+
+  void reset() { publish(nullptr); }
+
+  /** Destroys the retired values that no reader can see any more.
+      Returns the number of retired values still waiting.
+   */
+  size_type collect()
+  {
+    ::std::lock_guard< ::std::mutex> lock(write_mutex_);
+    return collect_locked();
+  }
+
+private:
+  optional_detail::rcu_reader_slot& claim_slot() const
+  {
+    for (::std::size_t i = 0; i != slots_.size(); ++i)
+    {
+      bool expected = false;
+      if (!slots_[i].in_use_.load(::std::memory_order_relaxed)
+          && slots_[i].in_use_.compare_exchange_strong(expected, true, ::std::memory_order_acquire))
+        return slots_[i];
+    }
+    throw_exception(::std::length_error("rcu_optional: too many readers"));
+  }
+
+  void publish(T const* v)
+  {
+    ::std::lock_guard< ::std::mutex> lock(write_mutex_);
+    T const* const old = value_.exchange(v, ::std::memory_order_seq_cst);
+    if (old)
+    {
+      retired_type const r = { old, epoch_.load(::std::memory_order_relaxed) };
+      retired_.push_back(r);
+    }
+    epoch_.fetch_add(1, ::std::memory_order_seq_cst);
+    collect_locked();
+  }
+
+  size_type collect_locked()
+  {
+    if (retired_.empty())
+      return 0;
+
+    // The oldest epoch still announced by a reader: values retired
+    // before it can no longer be seen.
+    ::std::uint64_t oldest = epoch_.load(::std::memory_order_seq_cst);
+    for (::std::size_t i = 0; i != slots_.size(); ++i)
+    {
+      ::std::uint64_t const e = slots_[i].epoch_.load(::std::memory_order_seq_cst);
+      if (e != optional_detail::rcu_quiescent && e < oldest)
+        oldest = e;
+    }
+
+    ::std::size_t kept = 0;
+    for (::std::size_t i = 0; i != retired_.size(); ++i)
+    {
+      if (retired_[i].epoch_ < oldest)
+        delete retired_[i].value_;
+      else
+        retired_[kept++] = retired_[i];
+    }
+    retired_.resize(kept);
+    return kept;
+  }
+
+  ::std::atomic<T const*> value_;
+  ::std::atomic< ::std::uint64_t> epoch_;
+  // the slots are over-aligned, which `std::allocator` only honours since C++17
+  mutable ::std::vector<optional_detail::rcu_reader_slot,
+                        optional_detail::aligned_allocator<optional_detail::rcu_reader_slot> > slots_;
+  ::std::mutex write_mutex_;
+  ::std::vector<retired_type> retired_;
+};
+
+} // namespace boost
+
+#endif // BOOST_NO_CXX11_HDR_ATOMIC
+
+#endif // header guard
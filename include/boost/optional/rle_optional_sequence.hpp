@@ -0,0 +1,269 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_RLE_OPTIONAL_SEQUENCE_19OCT2026_HPP
+#define BOOST_OPTIONAL_RLE_OPTIONAL_SEQUENCE_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/optional/optional.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace boost {
+
+/** An append-only sequence of `optional<T>` that stores the runs of
+    consecutive empty elements as a single length. The values of the present
+    elements are stored densely, in order; each run records the index one
+    past its last element and, for runs of present elements, the offset
+    of its first value.
+
+    The array of runs, ordered by their ends, serves as the skip index for
+    seeking: the run containing a given index is found by binary search.
+    Iteration and reductions advance run by run, so a run of empty elements
+    costs the same as a single element.
+ */
+template <class T>
+class rle_optional_sequence
+{
+public:
+  typedef T value_type;
+  typedef ::std::size_t size_type;
+
+  class const_iterator;
+
+  rle_optional_sequence() {}
+
+  // Builds the sequence from a range of `optional<T>`.
+  template <class InputIt>
+  rle_optional_sequence(InputIt first, InputIt last)
+  {
+    for (; first != last; ++first)
+      push_back(*first);
+  }
+
+  size_type size() const noexcept { return runs_.empty() ? 0 : runs_.back().end_; }
+  bool empty() const noexcept { return size() == 0; }
+
+  // The number of elements that have a value.
+  size_type count() const noexcept { return values_.size(); }
+
+  // The number of runs: maximal subsequences of either present or empty elements.
+  size_type run_count() const noexcept { return runs_.size(); }
+
+  void push_back(none_t)
+  {
+    append_none(1);
+  }
+
+  void push_back(T const& v)
+  {
+    emplace_back(v);
+  }
+
+  void push_back(T&& v)
+  {
+    emplace_back(optional_detail::move_(v));
+  }
+
+  void push_back(optional<T> const& o)
+  {
+    if (o)
+      emplace_back(*o);
+    else
+      append_none(1);
+  }
+
+  template <class... Args>
+  void emplace_back(Args&&... args)
+  {
+    // The new run is opened empty before the value is constructed, so that
+    // an exception leaves at most a zero-length run behind, which is reused
+    // by the next append.
+    if (runs_.empty() || runs_.back().first_value_ == npos)
+      open_run(values_.size());
+    values_.emplace_back(optional_detail::forward_<Args>(args)...);
+    ++runs_.back().end_;
+  }
+
+  // Appends `n` empty elements.
+  void append_none(size_type n)
+  {
+    if (n == 0)
+      return;
+
+    if (!runs_.empty() && runs_.back().end_ == run_begin(run_count() - 1))
+      runs_.back().first_value_ = npos;
+    else if (runs_.empty() || runs_.back().first_value_ != npos)
+      open_run(npos);
+    runs_.back().end_ += n;
+  }
+
+  // Returns the element at index `i`, in logarithmic time in the number of runs.
+  optional<T const&> operator[](size_type i) const noexcept
+  {
+    BOOST_ASSERT(i < size());
+    size_type const r = find_run(i);
+    return element(r, i);
+  }
+
+  const_iterator begin() const noexcept { return const_iterator(this, 0, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, size(), run_count()); }
+
+  // Returns the iterator to the element at index `i`.
+  const_iterator seek(size_type i) const noexcept
+  {
+    BOOST_ASSERT(i <= size());
+    return i == size() ? end() : const_iterator(this, i, find_run(i));
+  }
+
+  // Calls `f(i, first, last)` for every run of present elements, where `i` is
+  // the index of the first element in the run and `[first, last)` are its values.
+  template <class F>
+  void for_each_present_run(F f) const
+  {
+    for (size_type r = 0; r != run_count(); ++r)
+    {
+      if (runs_[r].first_value_ != npos)
+      {
+        T const* first = values_.data() + runs_[r].first_value_;
+        f(run_begin(r), first, first + (runs_[r].end_ - run_begin(r)));
+      }
+    }
+  }
+
+  // Folds `op` over the present values, in order, skipping the empty runs whole.
+  template <class U, class BinaryOp>
+  U reduce_present(U init, BinaryOp op) const
+  {
+    for (typename ::std::vector<T>::const_iterator it = values_.begin(); it != values_.end(); ++it)
+      init = op(optional_detail::move_(init), *it);
+    return init;
+  }
+
+  void clear() noexcept
+  {
+    values_.clear();
+    runs_.clear();
+  }
+
+  void swap(rle_optional_sequence& rhs) noexcept
+  {
+    values_.swap(rhs.values_);
+    runs_.swap(rhs.runs_);
+  }
+
+private:
+  static BOOST_CONSTEXPR_OR_CONST size_type npos = static_cast<size_type>(-1);
+
+  struct run
+  {
+    size_type end_;         // the index past the last element of the run
+    size_type first_value_; // the offset of the first value, or `npos` for an empty run
+  };
+
+  struct run_end_less
+  {
+    bool operator()(size_type i, run const& r) const noexcept { return i < r.end_; }
+  };
+
+  void open_run(size_type first_value)
+  {
+    run const r = { size(), first_value };
+    runs_.push_back(r);
+  }
+
+  size_type run_begin(size_type r) const noexcept
+  {
+    return r == 0 ? 0 : runs_[r - 1].end_;
+  }
+
+  size_type find_run(size_type i) const noexcept
+  {
+    return static_cast<size_type>(::std::upper_bound(runs_.begin(), runs_.end(), i, run_end_less()) - runs_.begin());
+  }
+
+  optional<T const&> element(size_type r, size_type i) const noexcept
+  {
+    return runs_[r].first_value_ == npos
+         ? optional<T const&>()
+         : optional<T const&>(values_[runs_[r].first_value_ + (i - run_begin(r))]);
+  }
+
+  ::std::vector<T> values_;
+  ::std::vector<run> runs_;
+};
+
+/** Iterates over all the elements of the sequence, present or not,
+    yielding `optional<T const&>`.
+ */
+template <class T>
+class rle_optional_sequence<T>::const_iterator
+{
+  friend class rle_optional_sequence<T>;
+
+  rle_optional_sequence const* seq_;
+  size_type index_;
+  size_type run_;
+
+  const_iterator(rle_optional_sequence const* seq, size_type index, size_type run) noexcept
+    : seq_(seq), index_(index), run_(run) {}
+
+public:
+  typedef ::std::input_iterator_tag iterator_category;
+  typedef optional<T const&> value_type;
+  typedef optional<T const&> reference;
+  typedef void pointer;
+  typedef ::std::ptrdiff_t difference_type;
+
+  const_iterator() noexcept : seq_(nullptr), index_(0), run_(0) {}
+
+  // The index of the element the iterator points to.
+  size_type index() const noexcept { return index_; }
+
+  reference operator*() const noexcept { return seq_->element(run_, index_); }
+
+  const_iterator& operator++() noexcept
+  {
+    if (++index_ == seq_->runs_[run_].end_)
+      ++run_;
+    return *this;
+  }
+
+  const_iterator operator++(int) noexcept
+  {
+    const_iterator ans = *this;
+    ++*this;
+    return ans;
+  }
+
+  // Advances to the first element of the next run.
+  const_iterator& next_run() noexcept
+  {
+    index_ = seq_->runs_[run_++].end_;
+    return *this;
+  }
+
+  friend bool operator==(const_iterator const& l, const_iterator const& r) noexcept { return l.index_ == r.index_; }
+  friend bool operator!=(const_iterator const& l, const_iterator const& r) noexcept { return l.index_ != r.index_; }
+};
+
+template <class T>
+inline void swap(rle_optional_sequence<T>& lhs, rle_optional_sequence<T>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+} // namespace boost
+
+#endif // header guard
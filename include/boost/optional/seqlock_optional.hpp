@@ -0,0 +1,155 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_SEQLOCK_OPTIONAL_19OCT2026_HPP
+#define BOOST_OPTIONAL_SEQLOCK_OPTIONAL_19OCT2026_HPP
+
+#include <boost/config.hpp>
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <boost/core/addressof.hpp>
+#include <boost/core/launder.hpp>
+#include <boost/optional/optional.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace boost {
+
+/** An `optional<T>`, for trivially copyable `T`, shared between one writer
+    thread and any number of reader threads under a sequence lock. Readers
+    never block the writer nor each other and write nothing to shared memory:
+    a read copies the value out and checks that the version counter has not
+    changed during the copy, retrying otherwise.
+
+    The value is stored as an array of 64-bit atomic words accessed with
+    relaxed operations, so that the copying races of the sequence lock are
+    well-defined; on common hardware these compile to plain loads and stores.
+    Only one thread at a time may call the modifying functions.
+ */
+template <class T>
+class seqlock_optional
+{
+  static_assert(::std::is_trivially_copyable<T>::value, "seqlock_optional<T> requires a trivially copyable T");
+
+  typedef ::std::uint64_t word_type;
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t word_count = (sizeof(T) + sizeof(word_type) - 1) / sizeof(word_type);
+
+public:
+  typedef T value_type;
+
+  seqlock_optional() noexcept : version_(0), has_value_(false)
+  {
+    for (::std::size_t i = 0; i != word_count; ++i)
+      words_[i].store(0, ::std::memory_order_relaxed);
+  }
+
+  explicit seqlock_optional(T const& v) noexcept : seqlock_optional()
+  {
+    store(v);
+  }
+
+  seqlock_optional(seqlock_optional const&) = delete;
+  seqlock_optional& operator=(seqlock_optional const&) = delete;
+
+  /** Returns a consistent snapshot of the value: a copy of the value
+      stored by the last completed write, or none if it stored none.
+      Retries while a write is in progress.
+   */
+  optional<T> try_read() const noexcept
+  {
+    word_type buf[word_count];
+    for (;;)
+    {
+      ::std::uint64_t const v1 = version_.load(::std::memory_order_acquire);
+      if (v1 & 1u)
+        continue; // a write is in progress
+
+      bool const has = has_value_.load(::std::memory_order_relaxed);
+      for (::std::size_t i = 0; i != word_count; ++i)
+        buf[i] = words_[i].load(::std::memory_order_relaxed);
+
+      ::std::atomic_thread_fence(::std::memory_order_acquire);
+      if (version_.load(::std::memory_order_relaxed) == v1)
+        return has ? optional<T>(value_of(buf)) : optional<T>();
+    }
+  }
+
+  /** Returns whether the last completed write stored a value. Checks the
+      version counter like `try_read()`, but copies no words of the value.
+   */
+  bool has_value() const noexcept
+  {
+    for (;;)
+    {
+      ::std::uint64_t const v1 = version_.load(::std::memory_order_acquire);
+      if (v1 & 1u)
+        continue; // a write is in progress
+
+      bool const has = has_value_.load(::std::memory_order_relaxed);
+
+      ::std::atomic_thread_fence(::std::memory_order_acquire);
+      if (version_.load(::std::memory_order_relaxed) == v1)
+        return has;
+    }
+  }
+
+  // The number of completed writes.
+  ::std::uint64_t version() const noexcept
+  {
+    return version_.load(::std::memory_order_acquire) / 2;
+  }
+
+  // Writer only.
+  void store(optional<T> const& v) noexcept
+  {
+    word_type buf[word_count] = {};
+    if (v)
+      ::std::memcpy(buf, ::boost::addressof(*v), sizeof(T));
+
+    ::std::uint64_t const v0 = version_.load(::std::memory_order_relaxed);
+    version_.store(v0 + 1, ::std::memory_order_relaxed);
+    ::std::atomic_thread_fence(::std::memory_order_release);
+
+    has_value_.store(static_cast<bool>(v), ::std::memory_order_relaxed);
+    for (::std::size_t i = 0; i != word_count; ++i)
+      words_[i].store(buf[i], ::std::memory_order_relaxed);
+
+    version_.store(v0 + 2, ::std::memory_order_release);
+  }
+
+  // Writer only.
+  void reset() noexcept
+  {
+    store(none);
+  }
+
+private:
+  static T value_of(word_type const* buf) noexcept
+  {
+    alignas(T) unsigned char bytes[sizeof(T)];
+    ::std::memcpy(bytes, buf, sizeof(T));
+    return *::boost::core::launder(reinterpret_cast<T*>(bytes));
+  }
+
+  ::std::atomic< ::std::uint64_t> version_; // odd while a write is in progress
+  ::std::atomic<bool> has_value_;
+  ::std::atomic<word_type> words_[word_count];
+};
+
+} // namespace boost
+
+#endif // BOOST_NO_CXX11_HDR_ATOMIC
+
+#endif // header guard
@@ -0,0 +1,302 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_SLOT_MAP_19OCT2026_HPP
+#define BOOST_OPTIONAL_SLOT_MAP_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace optional_detail {
+
+// A slot of `slot_map`: the storage of a `T` that, while the slot is free,
+// holds the index of the next free slot instead. The generation is odd
+// when the slot holds a value and even when it is free.
+template <class T>
+class slot_map_slot
+{
+public:
+  typedef ::std::uint32_t index_type;
+
+  template <class... Args>
+  explicit slot_map_slot(in_place_init_t, Args&&... args) : generation_(1)
+  {
+    ::new (static_cast<void*>(&u_.value_)) T(optional_detail::forward_<Args>(args)...);
+  }
+
+  slot_map_slot(slot_map_slot const& rhs) : generation_(rhs.generation_)
+  {
+    if (rhs.occupied())
+      ::new (static_cast<void*>(&u_.value_)) T(rhs.u_.value_);
+    else
+      u_.next_free_ = rhs.u_.next_free_;
+  }
+
+  slot_map_slot(slot_map_slot&& rhs) noexcept(::std::is_nothrow_move_constructible<T>::value)
+    : generation_(rhs.generation_)
+  {
+    if (rhs.occupied())
+      ::new (static_cast<void*>(&u_.value_)) T(optional_detail::move_(rhs.u_.value_));
+    else
+      u_.next_free_ = rhs.u_.next_free_;
+  }
+
+  slot_map_slot& operator=(slot_map_slot const&) = delete;
+
+  ~slot_map_slot()
+  {
+    if (occupied())
+      u_.value_.~T();
+  }
+
+  bool occupied() const noexcept { return (generation_ & 1u) != 0; }
+  ::std::uint32_t generation() const noexcept { return generation_; }
+
+  T& value() noexcept { BOOST_ASSERT(occupied()); return u_.value_; }
+  T const& value() const noexcept { BOOST_ASSERT(occupied()); return u_.value_; }
+
+  index_type next_free() const noexcept { BOOST_ASSERT(!occupied()); return u_.next_free_; }
+
+  // Constructs a value in a free slot. If the constructor throws,
+  // the slot stays free, with its link to the next free slot restored.
+  template <class... Args>
+  void construct(Args&&... args)
+  {
+    BOOST_ASSERT(!occupied());
+    struct restore_link
+    {
+      slot_map_slot& slot;
+      index_type next_free;
+      bool active;
+      ~restore_link() { if (active) slot.u_.next_free_ = next_free; }
+    } guard = { *this, u_.next_free_, true };
+
+    ::new (static_cast<void*>(&u_.value_)) T(optional_detail::forward_<Args>(args)...);
+    guard.active = false;
+    ++generation_;
+  }
+
+  // Destroys the value and links the slot into the free list.
+  void destroy(index_type next_free) noexcept
+  {
+    BOOST_ASSERT(occupied());
+    u_.value_.~T();
+    u_.next_free_ = next_free;
+    ++generation_;
+  }
+
+private:
+  union storage
+  {
+    index_type next_free_;
+    T value_;
+
+    storage() noexcept : next_free_() {}
+    ~storage() {} // the slot destroys the `T` if needed
+  };
+
+  ::std::uint32_t generation_;
+  storage u_;
+};
+
+}} // namespace boost::optional_detail
+
+
+namespace boost {
+
+/** A container that gives out stable handles to its elements, with
+    constant-time insertion, erasure and lookup. A handle is the index of
+    a slot together with the generation of the slot at the time of insertion;
+    a handle to an erased element no longer finds it, even after the slot is
+    reused, because every insertion and erasure bumps the generation.
+
+    A free slot stores no element, but the index of the next free slot in
+    the same bytes, so the free list needs no memory of its own. The only
+    per-slot overhead is the 32-bit generation, whose parity also tells if
+    the slot is occupied. A handle may falsely match again after the same
+    slot has been reused 2^31 times.
+ */
+template <class T>
+class slot_map
+{
+  typedef optional_detail::slot_map_slot<T> slot_type;
+  typedef typename slot_type::index_type index_type;
+
+public:
+  typedef T value_type;
+  typedef ::std::size_t size_type;
+
+  struct handle
+  {
+    index_type index;
+    ::std::uint32_t generation;
+
+    friend bool operator==(handle const& l, handle const& r) noexcept
+    {
+      return l.index == r.index && l.generation == r.generation;
+    }
+
+    friend bool operator!=(handle const& l, handle const& r) noexcept { return !(l == r); }
+  };
+
+  slot_map() noexcept : free_head_(npos), size_(0) {}
+
+  slot_map(slot_map const& rhs) = default;
+
+  slot_map(slot_map&& rhs) noexcept : free_head_(npos), size_(0)
+  {
+    swap(rhs);
+  }
+
+  // Slots cannot be assigned to one another, hence copy-and-swap.
+  slot_map& operator=(slot_map rhs) noexcept
+  {
+    swap(rhs);
+    return *this;
+  }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  // The number of slots, occupied or free.
+  size_type capacity() const noexcept { return slots_.size(); }
+
+  // The largest number of slots, limited by the 32-bit indices of the handles.
+  static BOOST_CONSTEXPR size_type max_size() noexcept { return npos; }
+
+  // Throws `std::length_error` if `n` exceeds `max_size()`.
+  void reserve(size_type n)
+  {
+    if (n > max_size())
+      throw_exception(::std::length_error("slot_map::reserve: too many slots"));
+    slots_.reserve(n);
+  }
+
+  // Throws `std::length_error` if all of `max_size()` slots are occupied.
+  template <class... Args>
+  handle emplace(Args&&... args)
+  {
+    index_type i = free_head_;
+    if (i != npos)
+    {
+      index_type const next = slots_[i].next_free();
+      slots_[i].construct(optional_detail::forward_<Args>(args)...);
+      free_head_ = next;
+    }
+    else
+    {
+      if (slots_.size() == max_size())
+        throw_exception(::std::length_error("slot_map::emplace: too many slots"));
+      i = static_cast<index_type>(slots_.size());
+      slots_.emplace_back(in_place_init, optional_detail::forward_<Args>(args)...);
+    }
+    ++size_;
+    handle const h = { i, slots_[i].generation() };
+    return h;
+  }
+
+  handle insert(T const& v) { return emplace(v); }
+  handle insert(T&& v) { return emplace(optional_detail::move_(v)); }
+
+  // Erases the element referred to by `h`; returns false if there is none.
+  bool erase(handle h) noexcept
+  {
+    if (!contains(h))
+      return false;
+    slots_[h.index].destroy(free_head_);
+    free_head_ = h.index;
+    --size_;
+    return true;
+  }
+
+  bool contains(handle h) const noexcept
+  {
+    // free slots have even generations, which are never given out in handles
+    return h.index < slots_.size() && slots_[h.index].generation() == h.generation && (h.generation & 1u) != 0;
+  }
+
+  optional<T&> find(handle h) noexcept
+  {
+    return contains(h) ? optional<T&>(slots_[h.index].value()) : optional<T&>();
+  }
+
+  optional<T const&> find(handle h) const noexcept
+  {
+    return contains(h) ? optional<T const&>(slots_[h.index].value()) : optional<T const&>();
+  }
+
+  // Calls `f(h, v)` for every element `v` with handle `h`, in the order of slots.
+  template <class F>
+  void for_each(F f)
+  {
+    for (index_type i = 0; i != slots_.size(); ++i)
+      if (slots_[i].occupied())
+      {
+        handle const h = { i, slots_[i].generation() };
+        f(h, slots_[i].value());
+      }
+  }
+
+  template <class F>
+  void for_each(F f) const
+  {
+    for (index_type i = 0; i != slots_.size(); ++i)
+      if (slots_[i].occupied())
+      {
+        handle const h = { i, slots_[i].generation() };
+        f(h, slots_[i].value());
+      }
+  }
+
+  // Erases all the elements; the handles to them are invalidated, but slots are kept.
+  void clear() noexcept
+  {
+    for (index_type i = static_cast<index_type>(slots_.size()); i-- != 0;)
+      if (slots_[i].occupied())
+      {
+        slots_[i].destroy(free_head_);
+        free_head_ = i;
+      }
+    size_ = 0;
+  }
+
+  void swap(slot_map& rhs) noexcept
+  {
+    slots_.swap(rhs.slots_);
+    ::std::swap(free_head_, rhs.free_head_);
+    ::std::swap(size_, rhs.size_);
+  }
+
+private:
+  static BOOST_CONSTEXPR_OR_CONST index_type npos = static_cast<index_type>(-1);
+
+  ::std::vector<slot_type> slots_;
+  index_type free_head_;
+  size_type size_;
+};
+
+template <class T>
+inline void swap(slot_map<T>& lhs, slot_map<T>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+} // namespace boost
+
+#endif // header guard
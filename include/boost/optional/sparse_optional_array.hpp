@@ -0,0 +1,223 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_SPARSE_OPTIONAL_ARRAY_19OCT2026_HPP
+#define BOOST_OPTIONAL_SPARSE_OPTIONAL_ARRAY_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/optional/detail/optional_bitmap.hpp>
+#include <boost/core/bit.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace boost {
+
+/** An append-only sequence of `optional<T>` optimized for the case where
+    most elements are empty. Only the present values are stored, densely,
+    together with the validity bitmap and a rank index over it.
+
+    The rank index stores the number of present values preceding every
+    block of `words_per_block` bitmap words, so that the position of a value
+    in the dense array (its rank) is computed with at most `words_per_block`
+    population counts. With 8 words per block the index costs 1/8 of a bit
+    per element.
+ */
+template <class T>
+class sparse_optional_array
+{
+  typedef optional_detail::bitmap_word word_type;
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t word_bits = optional_detail::bitmap_word_bits;
+
+public:
+  typedef T value_type;
+  typedef ::std::size_t size_type;
+
+  static BOOST_CONSTEXPR_OR_CONST ::std::size_t words_per_block = 8;
+
+  sparse_optional_array() : size_(0) {}
+
+  // Builds the array from a range of `optional<T>`.
+  template <class InputIt>
+  sparse_optional_array(InputIt first, InputIt last) : size_(0)
+  {
+    for (; first != last; ++first)
+      push_back(*first);
+  }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  // The number of elements that have a value.
+  size_type count() const noexcept { return values_.size(); }
+
+  // The present values, in the order of their indices.
+  T const* values() const noexcept { return values_.data(); }
+
+  void push_back(none_t)
+  {
+    grow(size_ + 1);
+    ++size_;
+  }
+
+  void push_back(T const& v)
+  {
+    emplace_back(v);
+  }
+
+  void push_back(T&& v)
+  {
+    emplace_back(optional_detail::move_(v));
+  }
+
+  void push_back(optional<T> const& o)
+  {
+    if (o)
+      emplace_back(*o);
+    else
+      push_back(none);
+  }
+
+  template <class... Args>
+  void emplace_back(Args&&... args)
+  {
+    grow(size_ + 1);
+    values_.emplace_back(optional_detail::forward_<Args>(args)...);
+    optional_detail::bitmap_set(bits_.data(), size_);
+    ++size_;
+  }
+
+  // Appends `n` empty elements.
+  void append_none(size_type n)
+  {
+    grow(size_ + n);
+    size_ += n;
+  }
+
+  bool has_value(size_type i) const noexcept
+  {
+    BOOST_ASSERT(i < size_);
+    return optional_detail::bitmap_test(bits_.data(), i);
+  }
+
+  optional<T const&> operator[](size_type i) const noexcept
+  {
+    return has_value(i) ? optional<T const&>(values_[rank(i)]) : optional<T const&>();
+  }
+
+  // The number of present values at indices lower than `i`.
+  size_type rank(size_type i) const noexcept
+  {
+    BOOST_ASSERT(i <= size_);
+    size_type const w = i / word_bits;
+    size_type const b = w / words_per_block;
+    size_type ans = b < block_ranks_.size() ? block_ranks_[b] : values_.size();
+    for (size_type k = b * words_per_block; k < w; ++k)
+      ans += static_cast<size_type>(::boost::core::popcount(bits_[k]));
+    if (i % word_bits != 0)
+      ans += static_cast<size_type>(::boost::core::popcount(bits_[w] & ((word_type(1) << (i % word_bits)) - 1)));
+    return ans;
+  }
+
+  // The index of the `k`-th present value; `k` must be lower than `count()`.
+  size_type select(size_type k) const noexcept
+  {
+    BOOST_ASSERT(k < count());
+    size_type const b = static_cast<size_type>(
+      ::std::upper_bound(block_ranks_.begin(), block_ranks_.end(), k) - block_ranks_.begin()) - 1;
+    k -= block_ranks_[b];
+    size_type w = b * words_per_block;
+    for (;; ++w)
+    {
+      size_type const c = static_cast<size_type>(::boost::core::popcount(bits_[w]));
+      if (k < c)
+        break;
+      k -= c;
+    }
+    word_type m = bits_[w];
+    for (; k != 0; --k)
+      m &= m - 1;
+    return w * word_bits + static_cast<size_type>(::boost::core::countr_zero(m));
+  }
+
+  // The index of the first present element at or after `i`, or `size()` if there is none.
+  size_type next_present(size_type i) const noexcept
+  {
+    size_type w = i / word_bits;
+    if (i >= size_)
+      return size_;
+    word_type m = bits_[w] & (~word_type(0) << (i % word_bits));
+    while (m == 0)
+    {
+      if (++w == bits_.size())
+        return size_;
+      m = bits_[w];
+    }
+    return w * word_bits + static_cast<size_type>(::boost::core::countr_zero(m));
+  }
+
+  // Calls `f(i, v)` for every index `i` that has a value `v`, in increasing
+  // order of indices. Runs of 64 empty elements are skipped with one test.
+  template <class F>
+  void for_each_present(F f) const
+  {
+    size_type r = 0;
+    for (size_type w = 0; w != bits_.size(); ++w)
+      for (word_type m = bits_[w]; m != 0; m &= m - 1)
+        f(w * word_bits + static_cast<size_type>(::boost::core::countr_zero(m)), values_[r++]);
+  }
+
+  void clear() noexcept
+  {
+    values_.clear();
+    bits_.clear();
+    block_ranks_.clear();
+    size_ = 0;
+  }
+
+  void swap(sparse_optional_array& rhs) noexcept
+  {
+    values_.swap(rhs.values_);
+    bits_.swap(rhs.bits_);
+    block_ranks_.swap(rhs.block_ranks_);
+    ::std::swap(size_, rhs.size_);
+  }
+
+private:
+  // Makes room for `n` elements in the bitmap, recording the rank of every new block.
+  void grow(size_type n)
+  {
+    size_type const nw = optional_detail::bitmap_words(n);
+    while (bits_.size() < nw)
+    {
+      if (bits_.size() % words_per_block == 0)
+        block_ranks_.push_back(values_.size());
+      bits_.push_back(0);
+    }
+  }
+
+  ::std::vector<T> values_;
+  ::std::vector<word_type> bits_;
+  ::std::vector<size_type> block_ranks_;
+  size_type size_;
+};
+
+template <class T>
+inline void swap(sparse_optional_array<T>& lhs, sparse_optional_array<T>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+} // namespace boost
+
+#endif // header guard
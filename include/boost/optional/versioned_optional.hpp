@@ -0,0 +1,182 @@
+// Copyright (C) 2026 Andrzej Krzemieński.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#ifndef BOOST_OPTIONAL_VERSIONED_OPTIONAL_19OCT2026_HPP
+#define BOOST_OPTIONAL_VERSIONED_OPTIONAL_19OCT2026_HPP
+
+#include <boost/assert.hpp>
+#include <boost/optional/optional.hpp>
+#include <cstdint>
+
+namespace boost {
+
+/** An `optional<T>` with a generation counter that is incremented by every
+    modification, for caches of derived values in incremental computations:
+    a dependent remembers the generation of each input it has used and
+    `changed_since()` tells it, with one comparison, whether it needs to
+    recompute.
+
+    `emplace()`, the assignments, `reset()` and `modify()` always count as
+    a change. `update()` counts as a change only if the new state differs
+    from the current one, so that an input recomputed to an equal value does
+    not make its dependents recompute in turn.
+
+    The value is accessible only as `T const`, as a modification through a
+    reference could not be counted; use `modify()` to change it in place.
+ */
+template <class T>
+class versioned_optional
+{
+public:
+  typedef T value_type;
+  typedef ::std::uint64_t generation_type;
+
+  versioned_optional() noexcept : generation_(0) {}
+  versioned_optional(none_t) noexcept : generation_(0) {}
+  versioned_optional(T const& v) : value_(v), generation_(0) {}
+  versioned_optional(T&& v) : value_(optional_detail::move_(v)), generation_(0) {}
+
+  template <class... Args>
+  explicit versioned_optional(in_place_init_t, Args&&... args)
+    : value_(in_place_init, optional_detail::forward_<Args>(args)...), generation_(0) {}
+
+  // A copy starts at the generation of the original.
+  versioned_optional(versioned_optional const&) = default;
+  versioned_optional(versioned_optional&&) = default;
+
+  // The number of modifications so far.
+  generation_type generation() const noexcept { return generation_; }
+
+  // Whether the object has been modified since it was at generation `g`.
+  bool changed_since(generation_type g) const noexcept { return generation_ != g; }
+
+  optional<T> const& get() const noexcept { return value_; }
+
+  bool has_value() const noexcept { return value_.has_value(); }
+  explicit operator bool() const noexcept { return has_value(); }
+
+  T const& operator*() const noexcept
+  {
+    BOOST_ASSERT(has_value());
+    return *value_;
+  }
+
+  T const* operator->() const noexcept
+  {
+    BOOST_ASSERT(has_value());
+    return value_.get_ptr();
+  }
+
+  T const& value() const { return value_.value(); }
+
+  template <class U>
+  T value_or(U&& v) const { return value_.value_or(optional_detail::forward_<U>(v)); }
+
+  template <class... Args>
+  T const& emplace(Args&&... args)
+  {
+    value_.emplace(optional_detail::forward_<Args>(args)...);
+    ++generation_;
+    return *value_;
+  }
+
+  // Assigns the value of `rhs`; the generation of `rhs` is not copied.
+  versioned_optional& operator=(versioned_optional const& rhs)
+  {
+    value_ = rhs.value_;
+    ++generation_;
+    return *this;
+  }
+
+  versioned_optional& operator=(versioned_optional&& rhs)
+  {
+    value_ = optional_detail::move_(rhs.value_);
+    ++generation_;
+    return *this;
+  }
+
+  versioned_optional& operator=(none_t) noexcept
+  {
+    reset();
+    return *this;
+  }
+
+  versioned_optional& operator=(T const& v)
+  {
+    value_ = v;
+    ++generation_;
+    return *this;
+  }
+
+  versioned_optional& operator=(T&& v)
+  {
+    value_ = optional_detail::move_(v);
+    ++generation_;
+    return *this;
+  }
+
+  versioned_optional& operator=(optional<T> const& v)
+  {
+    value_ = v;
+    ++generation_;
+    return *this;
+  }
+
+  versioned_optional& operator=(optional<T>&& v)
+  {
+    value_ = optional_detail::move_(v);
+    ++generation_;
+    return *this;
+  }
+
+  void reset() noexcept
+  {
+    value_ = none;
+    ++generation_;
+  }
+
+  // Passes the value, which must be present, to `f` for modification in place.
+  template <class F>
+  void modify(F f)
+  {
+    BOOST_ASSERT(has_value());
+    ++generation_;
+    f(*value_);
+  }
+
+  /** Assigns `v` if it differs from the current state; two empty optionals
+      are equal and values are compared with `==`. Returns true if the
+      object has changed.
+   */
+  bool update(optional<T> const& v)
+  {
+    if (value_ == v)
+      return false;
+    *this = v;
+    return true;
+  }
+
+  bool update(optional<T>&& v)
+  {
+    if (value_ == v)
+      return false;
+    *this = optional_detail::move_(v);
+    return true;
+  }
+
+private:
+  optional<T> value_;
+  generation_type generation_;
+};
+
+} // namespace boost
+
+#endif // header guard
@@ -0,0 +1,114 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_algorithm.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+template <class T>
+void check_against_std(std::vector<optional<T> > const& a, std::vector<optional<T> > const& b)
+{
+  optional<T> const* a0 = a.data();
+  optional<T> const* a1 = a.data() + a.size();
+  optional<T> const* b0 = b.data();
+  optional<T> const* b1 = b.data() + b.size();
+
+  BOOST_TEST_EQ(boost::lexicographical_compare_optionals(a0, a1, b0, b1),
+                std::lexicographical_compare(a0, a1, b0, b1));
+  BOOST_TEST_EQ(boost::lexicographical_compare_optionals(b0, b1, a0, a1),
+                std::lexicographical_compare(b0, b1, a0, a1));
+
+  std::size_t const n = std::min(a.size(), b.size());
+  BOOST_TEST(boost::mismatch_optionals(a0, a0 + n, b0) == std::mismatch(a0, a0 + n, b0));
+  BOOST_TEST(boost::mismatch_optionals(a0, a1, b0, b1).first - a0 == std::mismatch(a0, a0 + n, b0).first - a0);
+  BOOST_TEST_EQ(boost::equal_optionals(a0, a1, b0, b1), a.size() == b.size() && std::equal(a0, a1, b0));
+}
+
+std::vector<optional<int> > make_ints(std::size_t n, unsigned seed)
+{
+  std::vector<optional<int> > ans;
+  for (std::size_t i = 0; i != n; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    if ((seed >> 16) % 4 == 0)
+      ans.push_back(none);
+    else
+      ans.push_back(int((seed >> 8) % 3));
+  }
+  return ans;
+}
+
+void test_ints()
+{
+  for (unsigned s = 0; s != 50; ++s)
+  {
+    std::vector<optional<int> > a = make_ints(150, s);
+    std::vector<optional<int> > b = a;
+    check_against_std(a, b);
+
+    std::size_t const pos = (s * 37u) % a.size();
+    b[pos] = b[pos] ? optional<int>() : optional<int>(1);
+    check_against_std(a, b);
+
+    b = make_ints(100 + s, s + 1);
+    check_against_std(a, b);
+
+    b = a;
+    b.resize(a.size() - 1);
+    check_against_std(a, b);
+  }
+}
+
+void test_none_sorts_first()
+{
+  std::vector<optional<int> > a = { 1, none };
+  std::vector<optional<int> > b = { 1, std::numeric_limits<int>::min() };
+  BOOST_TEST(boost::lexicographical_compare_optionals(a.data(), a.data() + 2, b.data(), b.data() + 2));
+  BOOST_TEST(!boost::lexicographical_compare_optionals(b.data(), b.data() + 2, a.data(), a.data() + 2));
+  check_against_std(a, b);
+}
+
+void test_doubles()
+{
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<optional<double> > a = { 1.0, nan, none, 0.0 };
+  std::vector<optional<double> > b = { 1.0, nan, none, -0.0 };
+  check_against_std(a, b);
+  BOOST_TEST(!boost::equal_optionals(a.data(), a.data() + a.size(), b.data()));
+
+  b[1] = 2.0;
+  check_against_std(a, b);
+}
+
+void test_non_trivial()
+{
+  std::vector<optional<std::string> > a = { std::string("a"), none, std::string("c") };
+  std::vector<optional<std::string> > b = { std::string("a"), none, std::string("b") };
+  check_against_std(a, b);
+  check_against_std(a, a);
+}
+
+int main()
+{
+  test_ints();
+  test_none_sorts_first();
+  test_doubles();
+  test_non_trivial();
+
+  return boost::report_errors();
+}
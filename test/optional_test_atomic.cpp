@@ -0,0 +1,139 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/atomic_optional.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+struct leader_id
+{
+  std::int64_t id;
+  explicit leader_id(std::int64_t id) : id(id) {}
+};
+
+namespace boost {
+
+template <>
+struct atomic_optional_niche<leader_id> : std::true_type
+{
+  static leader_id get() noexcept { return leader_id(-1); }
+};
+
+} // namespace boost
+
+void test_flagged()
+{
+  boost::atomic_optional<std::int32_t> a;
+  BOOST_TEST(!a.load());
+  BOOST_TEST(!a.has_value());
+  BOOST_TEST(a.is_lock_free());
+
+  a.store(0);
+  BOOST_TEST(a.load());
+  BOOST_TEST_EQ(*a.load(), 0);
+
+  BOOST_TEST(!a.emplace_if_empty(5));
+  BOOST_TEST_EQ(*a.exchange(none), 0);
+  BOOST_TEST(a.emplace_if_empty(5));
+  BOOST_TEST_EQ(*a.load(), 5);
+
+  optional<std::int32_t> expected = 4;
+  BOOST_TEST(!a.compare_exchange_strong(expected, 6));
+  BOOST_TEST_EQ(*expected, 5);
+  BOOST_TEST(a.compare_exchange_strong(expected, none));
+  BOOST_TEST(!a.load());
+
+  expected = none;
+  BOOST_TEST(a.compare_exchange_strong(expected, -1));
+  BOOST_TEST_EQ(*a.load(), -1);
+  a.reset();
+  BOOST_TEST(!a.has_value());
+
+  boost::atomic_optional<char> c('x');
+  BOOST_TEST_EQ(sizeof(c), 2u);
+  BOOST_TEST_EQ(*c.load(), 'x');
+}
+
+void test_niche()
+{
+  boost::atomic_optional<leader_id> a;
+  BOOST_TEST_EQ(sizeof(a), 8u);
+  BOOST_TEST(!a.load());
+
+  a.store(leader_id(0));
+  BOOST_TEST_EQ(a.load()->id, 0);
+  BOOST_TEST(!a.emplace_if_empty(leader_id(7)));
+
+  optional<leader_id> expected = leader_id(0);
+  BOOST_TEST(a.compare_exchange_weak(expected, leader_id(3)) || a.load()->id == 0);
+  a.reset();
+  BOOST_TEST(!a.load());
+}
+
+void test_threads()
+{
+  // every thread claims the slot once it is empty and releases it again;
+  // the slot is never claimed by two threads at a time
+  boost::atomic_optional<std::uint32_t> owner;
+  std::vector<int> claims(4, 0);
+  std::vector<int> errors(4, 0);
+  std::vector<std::thread> threads;
+  for (std::uint32_t t = 0; t != 4; ++t)
+    threads.push_back(std::thread([&owner, &claims, &errors, t]
+    {
+      for (int i = 0; i != 10000; ++i)
+      {
+        if (!owner.emplace_if_empty(t))
+          continue;
+        ++claims[t];
+        optional<std::uint32_t> const prev = owner.exchange(none);
+        if (!prev || *prev != t)
+          ++errors[t];
+      }
+    }));
+  for (std::size_t t = 0; t != threads.size(); ++t)
+    threads[t].join();
+
+  int total = 0;
+  for (int t = 0; t != 4; ++t)
+  {
+    BOOST_TEST_EQ(errors[t], 0);
+    total += claims[t];
+  }
+  BOOST_TEST_GT(total, 0);
+  BOOST_TEST(!owner.load());
+}
+
+int main()
+{
+  test_flagged();
+  test_niche();
+  test_threads();
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,97 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_batch_hash.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+void test_scalar_hasher()
+{
+  boost::optional_batch_hasher h;
+  BOOST_TEST_NE(h(optional<long long>()), 0u);
+  BOOST_TEST_EQ(h(optional<long long>()), h.empty_hash());
+  BOOST_TEST_EQ(h(optional<long long>(1)), h(optional<long long>(1)));
+  BOOST_TEST_NE(h(optional<long long>(1)), h(optional<long long>(2)));
+  BOOST_TEST_NE(h(optional<long long>(0)), h(optional<long long>()));
+
+  boost::optional_batch_hasher h7(7);
+  BOOST_TEST_EQ(h7.seed(), 7u);
+  BOOST_TEST_NE(h7(optional<long long>(1)), h(optional<long long>(1)));
+  BOOST_TEST_NE(h7.empty_hash(), h.empty_hash());
+
+  boost::optional_batch_hasher hx(7, 42);
+  BOOST_TEST_EQ(hx(optional<long long>()), 42u);
+  BOOST_TEST_EQ(hx(optional<long long>(1)), h7(optional<long long>(1)));
+}
+
+void test_hash_column()
+{
+  std::vector<optional<std::int64_t> > col;
+  for (std::int64_t i = 0; i != 21; ++i)
+    col.push_back(i % 3 ? optional<std::int64_t>(i) : optional<std::int64_t>());
+
+  boost::optional_batch_hasher h(123);
+  std::vector<std::uint64_t> hashes(col.size());
+  BOOST_TEST(boost::hash_column(col.begin(), col.end(), hashes.begin(), h) == hashes.end());
+  for (std::size_t i = 0; i != col.size(); ++i)
+    BOOST_TEST_EQ(hashes[i], h(col[i]));
+}
+
+void test_hash_bitmap_column()
+{
+  std::vector<std::int64_t> values;
+  std::vector<optional<std::int64_t> > col;
+  std::vector<std::uint64_t> bits(1, 0);
+  for (std::int64_t i = 0; i != 19; ++i)
+  {
+    values.push_back(i);
+    if (i % 2)
+    {
+      boost::optional_detail::bitmap_set(bits.data(), std::size_t(i));
+      col.push_back(i);
+    }
+    else
+    {
+      col.push_back(none);
+    }
+  }
+
+  boost::optional_bitmap_span<const std::int64_t> span(bits.data(), values.data(), values.size());
+  std::vector<std::uint64_t> from_bitmap(values.size()), from_optionals(values.size());
+  boost::hash_column(span, from_bitmap.begin());
+  boost::hash_column(col.begin(), col.end(), from_optionals.begin());
+  BOOST_TEST(from_bitmap == from_optionals);
+}
+
+void test_hash_non_integral()
+{
+  std::vector<optional<std::string> > col = { std::string("a"), none, std::string("a") };
+  std::vector<std::uint64_t> hashes(col.size());
+  boost::hash_column(col.begin(), col.end(), hashes.begin());
+  BOOST_TEST_EQ(hashes[0], hashes[2]);
+  BOOST_TEST_EQ(hashes[1], boost::optional_batch_hasher().empty_hash());
+}
+
+int main()
+{
+  test_scalar_hasher();
+  test_hash_column();
+  test_hash_bitmap_column();
+  test_hash_non_integral();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_coalesce.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+typedef boost::optional_bitmap_span<const int> int_span;
+
+void test_value_or_fill()
+{
+  std::vector<optional<int> > col = { 1, none, 3, none };
+  std::vector<int> out(col.size());
+
+  std::vector<int>::iterator it = boost::value_or_fill(col.begin(), col.end(), out.begin(), -1);
+  BOOST_TEST(it == out.end());
+  BOOST_TEST_EQ(out[0], 1);
+  BOOST_TEST_EQ(out[1], -1);
+  BOOST_TEST_EQ(out[2], 3);
+  BOOST_TEST_EQ(out[3], -1);
+}
+
+void test_value_or_fill_bitmap()
+{
+  const std::size_t n = 130;
+  std::vector<int> values(n);
+  std::vector<std::uint64_t> bits(boost::optional_detail::bitmap_words(n));
+  for (std::size_t i = 0; i != n; ++i)
+  {
+    values[i] = int(i);
+    if (i % 3 == 0)
+      boost::optional_detail::bitmap_set(bits.data(), i);
+  }
+
+  int_span col(bits.data(), values.data(), n);
+  BOOST_TEST_EQ(col.count(), 44u);
+
+  std::vector<int> out(n);
+  boost::value_or_fill(col, out.begin(), -1);
+  for (std::size_t i = 0; i != n; ++i)
+    BOOST_TEST_EQ(out[i], i % 3 == 0 ? int(i) : -1);
+}
+
+void test_coalesce_optionals()
+{
+  std::vector<optional<int> > c1 = { 1,    none, none, none };
+  std::vector<optional<int> > c2 = { 10,   20,   none, none };
+  std::vector<optional<int> > c3 = { 100,  200,  300,  none };
+  std::vector<int> out(c1.size());
+
+  boost::coalesce_n(out.size(), out.begin(), 0, c1.begin(), c2.begin(), c3.begin());
+  BOOST_TEST_EQ(out[0], 1);
+  BOOST_TEST_EQ(out[1], 20);
+  BOOST_TEST_EQ(out[2], 300);
+  BOOST_TEST_EQ(out[3], 0);
+}
+
+void test_coalesce_mixed_layouts()
+{
+  std::vector<optional<long> > c1 = { none, 2, none, none };
+  std::vector<int> values = { 7, 8, 9, 10 };
+  std::vector<std::uint64_t> bits(1, 0x5); // elements 0 and 2
+  int_span c2(bits.data(), values.data(), values.size());
+
+  std::vector<long> out;
+  boost::coalesce_n(c1.size(), std::back_inserter(out), -1L, c1.data(), c2);
+  BOOST_TEST_EQ(out.size(), 4u);
+  BOOST_TEST_EQ(out[0], 7);
+  BOOST_TEST_EQ(out[1], 2);
+  BOOST_TEST_EQ(out[2], 9);
+  BOOST_TEST_EQ(out[3], -1);
+}
+
+void test_coalesce_non_trivial()
+{
+  std::vector<optional<std::string> > c1 = { std::string("a"), none };
+  std::vector<optional<std::string> > c2 = { std::string("b"), none };
+  std::vector<std::string> out(2);
+
+  boost::coalesce_n(2, out.begin(), std::string("-"), c1.begin(), c2.begin());
+  BOOST_TEST_EQ(out[0], "a");
+  BOOST_TEST_EQ(out[1], "-");
+}
+
+void test_bitmap_span()
+{
+  std::vector<int> values = { 1, 2, 3 };
+  std::vector<std::uint64_t> bits(1, 0x2);
+  boost::optional_bitmap_span<int> span(bits.data(), values.data(), values.size());
+
+  BOOST_TEST(!span.has_value(0));
+  BOOST_TEST(span.has_value(1));
+  BOOST_TEST(!span[0]);
+  BOOST_TEST(span[1]);
+  *span[1] = 5;
+  BOOST_TEST_EQ(values[1], 5);
+
+  int_span cspan = span;
+  BOOST_TEST_EQ(cspan.size(), 3u);
+  BOOST_TEST_EQ(*cspan[1], 5);
+}
+
+int main()
+{
+  test_value_or_fill();
+  test_value_or_fill_bitmap();
+  test_coalesce_optionals();
+  test_coalesce_mixed_layouts();
+  test_coalesce_non_trivial();
+  test_bitmap_span();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_compact.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+void test_compact_optionals()
+{
+  std::vector<optional<int> > col;
+  for (int i = 0; i != 200; ++i)
+    col.push_back(i % 5 == 0 || (i >= 64 && i < 128) ? optional<int>(i) : optional<int>());
+
+  std::vector<int> values;
+  std::vector<std::size_t> indices;
+  boost::compact_present(col.begin(), col.end(), std::back_inserter(values), std::back_inserter(indices));
+
+  BOOST_TEST_EQ(values.size(), indices.size());
+  std::size_t k = 0;
+  for (std::size_t i = 0; i != col.size(); ++i)
+  {
+    if (col[i])
+    {
+      BOOST_TEST_EQ(values[k], *col[i]);
+      BOOST_TEST_EQ(indices[k], i);
+      ++k;
+    }
+  }
+  BOOST_TEST_EQ(k, values.size());
+
+  std::vector<int> values_only;
+  boost::compact_present(col.begin(), col.end(), std::back_inserter(values_only));
+  BOOST_TEST(values_only == values);
+}
+
+void test_compact_bitmap()
+{
+  const std::size_t n = 100;
+  std::vector<int> dense(n);
+  std::vector<std::uint64_t> bits(boost::optional_detail::bitmap_words(n));
+  for (std::size_t i = 0; i != n; ++i)
+  {
+    dense[i] = int(i) * 10;
+    if (i % 7 == 3)
+      boost::optional_detail::bitmap_set(bits.data(), i);
+  }
+
+  boost::optional_bitmap_span<const int> col(bits.data(), dense.data(), n);
+  std::vector<int> values(col.count());
+  std::vector<std::size_t> indices(col.count());
+  std::pair<std::vector<int>::iterator, std::vector<std::size_t>::iterator> r
+    = boost::compact_present(col, values.begin(), indices.begin());
+
+  BOOST_TEST(r.first == values.end());
+  BOOST_TEST(r.second == indices.end());
+  for (std::size_t k = 0; k != values.size(); ++k)
+  {
+    BOOST_TEST_EQ(indices[k] % 7, 3u);
+    BOOST_TEST_EQ(values[k], int(indices[k]) * 10);
+  }
+}
+
+void test_scatter_roundtrip()
+{
+  std::vector<optional<std::string> > col = { std::string("a"), none, none, std::string("d"), none };
+  std::vector<std::string> values;
+  std::vector<std::size_t> indices;
+  boost::compact_present(col.begin(), col.end(), std::back_inserter(values), std::back_inserter(indices));
+
+  std::vector<optional<std::string> > back(col.size());
+  boost::scatter_present(values.begin(), values.end(), indices.begin(), back.begin());
+  BOOST_TEST(back == col);
+}
+
+void test_scatter_bitmap()
+{
+  std::vector<int> dense(70, 0);
+  std::vector<std::uint64_t> bits(2, 0);
+  boost::optional_detail::bitmap_set(bits.data(), 1);
+  boost::optional_detail::bitmap_set(bits.data(), 65);
+  boost::optional_bitmap_span<int> dest(bits.data(), dense.data(), dense.size());
+
+  const int src[] = { 4, 5 };
+  const int* end = boost::scatter_present(src, dest);
+  BOOST_TEST(end == src + 2);
+  BOOST_TEST_EQ(dense[1], 4);
+  BOOST_TEST_EQ(dense[65], 5);
+  BOOST_TEST_EQ(dense[0], 0);
+}
+
+int main()
+{
+  test_compact_optionals();
+  test_compact_bitmap();
+  test_scatter_roundtrip();
+  test_scatter_bitmap();
+
+  return boost::report_errors();
+}
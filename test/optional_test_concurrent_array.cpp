@@ -0,0 +1,141 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/concurrent_optional_array.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct schema
+{
+  std::size_t id;
+  std::string text;
+
+  schema(std::size_t id, std::string text) : id(id), text(text) {}
+  schema(schema const&) = delete;
+  schema(schema&&) = default;
+};
+
+struct decoder
+{
+  int* calls;
+
+  schema operator()(std::size_t id) const
+  {
+    ++*calls;
+    return schema(id, std::to_string(id));
+  }
+};
+
+void test_single_thread()
+{
+  int calls = 0;
+  boost::concurrent_optional_array<schema> a(600);
+  BOOST_TEST_EQ(a.size(), 600u);
+  BOOST_TEST(!a.has_value(0));
+  BOOST_TEST(!a.get(599));
+
+  // slots in different words and different control lines
+  std::size_t const ids[] = { 0, 1, 31, 32, 255, 256, 599 };
+  for (std::size_t id : ids)
+  {
+    schema& s = a.get_or_compute(id, decoder{&calls});
+    BOOST_TEST_EQ(s.id, id);
+    BOOST_TEST_EQ(s.text, std::to_string(id));
+  }
+  for (std::size_t id : ids)
+  {
+    BOOST_TEST(a.has_value(id));
+    BOOST_TEST_EQ(&a.get_or_compute(id, decoder{&calls}), &*a.get(id));
+  }
+  BOOST_TEST_EQ(calls, 7);
+  BOOST_TEST(!a.has_value(2));
+  BOOST_TEST(!a.has_value(30));
+  BOOST_TEST(!a.has_value(257));
+
+  boost::concurrent_optional_array<schema> const& ca = a;
+  BOOST_TEST_EQ(ca.get(256)->id, 256u);
+  BOOST_TEST(!ca.get(3));
+}
+
+void test_throwing_compute()
+{
+  boost::concurrent_optional_array<std::string> a(64);
+  a.get_or_compute(4, [](std::size_t) { return std::string("four"); });
+
+  BOOST_TEST_THROWS(a.get_or_compute(5, [](std::size_t) -> std::string { throw std::runtime_error("bad"); }),
+                    std::runtime_error);
+  BOOST_TEST(!a.has_value(5));
+  BOOST_TEST(a.has_value(4));
+  BOOST_TEST(!a.has_value(6));
+
+  BOOST_TEST_EQ(a.get_or_compute(5, [](std::size_t) { return std::string("five"); }), "five");
+  BOOST_TEST_EQ(*a.get(4), "four");
+}
+
+void test_threads()
+{
+  // every thread asks for every slot; each slot is computed exactly once,
+  // even though neighbouring slots share control words
+  std::size_t const n = 1000;
+  boost::concurrent_optional_array<std::vector<std::size_t> > a(n);
+  std::vector<std::atomic<int> > computed(n);
+  for (std::size_t i = 0; i != n; ++i)
+    computed[i].store(0);
+  std::atomic<int> errors(0);
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t != 6; ++t)
+    threads.push_back(std::thread([&, t]
+    {
+      for (std::size_t k = 0; k != n; ++k)
+      {
+        std::size_t const i = (k * 7 + t * 131) % n;
+        std::vector<std::size_t> const& v = a.get_or_compute(i, [&computed](std::size_t j)
+        {
+          ++computed[j];
+          return std::vector<std::size_t>(16, j);
+        });
+        if (v.size() != 16 || v.back() != i)
+          ++errors;
+      }
+    }));
+  for (std::size_t t = 0; t != threads.size(); ++t)
+    threads[t].join();
+
+  BOOST_TEST_EQ(errors.load(), 0);
+  for (std::size_t i = 0; i != n; ++i)
+    BOOST_TEST_EQ(computed[i].load(), 1);
+}
+
+int main()
+{
+  test_single_thread();
+  test_throwing_compute();
+  test_threads();
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,211 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_coroutine.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#ifdef BOOST_OPTIONAL_HAS_COROUTINE_SUPPORT
+
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+using boost::optional;
+using boost::none;
+
+static int allocations = 0;
+
+void* operator new(std::size_t n)
+{
+  ++allocations;
+  if (void* p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+optional<int> parse_digit(char c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  return none;
+}
+
+optional<int> parse_pair(char a, char b)
+{
+  int x = co_await parse_digit(a);
+  int y = co_await parse_digit(b);
+  co_return x * 10 + y;
+}
+
+optional<int> sum_of_pairs(char const* s)
+{
+  int total = 0;
+  for (; s[0] != '\0'; s += 2)
+    total += co_await parse_pair(s[0], s[1]);
+  co_return total;
+}
+
+void test_short_circuit()
+{
+  BOOST_TEST_EQ(*parse_pair('4', '2'), 42);
+  BOOST_TEST(!parse_pair('4', 'x'));
+  BOOST_TEST(!parse_pair('x', '2'));
+
+  BOOST_TEST_EQ(*sum_of_pairs("102030"), 60);
+  BOOST_TEST(!sum_of_pairs("1020x0"));
+}
+
+struct counter
+{
+  int* live;
+  explicit counter(int* live) : live(live) { ++*live; }
+  ~counter() { --*live; }
+};
+
+typedef std::map<std::string, std::string> config_map;
+
+optional<std::string const&> lookup(config_map const& config, std::string const& key)
+{
+  config_map::const_iterator const it = config.find(key);
+  if (it == config.end())
+    return none;
+  return it->second;
+}
+
+optional<std::string> find_address(config_map const& config, int* live, int* reached)
+{
+  counter c(live);
+  optional<std::string> const host(lookup(config, "host"));
+  std::string const& h = co_await host;
+  ++*reached;
+  counter c2(live);
+  std::string const& p = co_await lookup(config, "port");
+  ++*reached;
+  co_return h + ":" + p;
+}
+
+void test_locals_destroyed()
+{
+  int live = 0, reached = 0;
+  config_map config;
+
+  BOOST_TEST(!find_address(config, &live, &reached));
+  BOOST_TEST_EQ(live, 0);
+  BOOST_TEST_EQ(reached, 0);
+
+  config["host"] = "localhost";
+  BOOST_TEST(!find_address(config, &live, &reached));
+  BOOST_TEST_EQ(live, 0);
+  BOOST_TEST_EQ(reached, 1);
+
+  config["port"] = "8080";
+  BOOST_TEST_EQ(*find_address(config, &live, &reached), "localhost:8080");
+  BOOST_TEST_EQ(live, 0);
+  BOOST_TEST_EQ(reached, 3);
+}
+
+optional<std::unique_ptr<int> > take_owned(optional<std::unique_ptr<int> > o)
+{
+  std::unique_ptr<int> p = co_await std::move(o);
+  *p += 1;
+  co_return std::move(p);
+}
+
+optional<int> bump(optional<int>& o)
+{
+  int& v = co_await o;
+  ++v;
+  co_return none;
+}
+
+void test_value_categories()
+{
+  optional<std::unique_ptr<int> > r = take_owned(std::unique_ptr<int>(new int(5)));
+  BOOST_TEST_EQ(**r, 6);
+  BOOST_TEST(!take_owned(none));
+
+  optional<int> o = 1;
+  BOOST_TEST(!bump(o));
+  BOOST_TEST_EQ(*o, 2);
+}
+
+optional<int> checked_ratio(int a, int b)
+{
+  int const x = co_await optional<int>(a);
+  if (b == 0)
+    throw std::domain_error("division by zero");
+  co_return x / b;
+}
+
+void test_exceptions()
+{
+  BOOST_TEST_EQ(*checked_ratio(6, 3), 2);
+  BOOST_TEST_THROWS(checked_ratio(6, 0), std::domain_error);
+  BOOST_TEST_EQ(*checked_ratio(8, 4), 2);
+}
+
+void test_no_allocations()
+{
+  sum_of_pairs("11"); // creates the frame stack of the thread
+  int const before = allocations;
+  int total = 0;
+  for (int i = 0; i != 1000; ++i)
+  {
+    total += sum_of_pairs("0102030405").value_or(0);
+    total += sum_of_pairs("01x2").value_or(0);
+  }
+  BOOST_TEST_EQ(total, 15000);
+  BOOST_TEST_EQ(allocations, before);
+}
+
+optional<int> deep(int n)
+{
+  char padding[512] = {};
+  if (n == 0)
+    co_return padding[0];
+  int const r = co_await deep(n - 1);
+  padding[n % 512] = 1;
+  co_return r + padding[n % 512];
+}
+
+void test_deep_nesting()
+{
+  // the frames outgrow the first block of the frame stack
+  BOOST_TEST_EQ(*deep(200), 200);
+  BOOST_TEST_EQ(*deep(200), 200);
+}
+
+int main()
+{
+  test_short_circuit();
+  test_locals_destroyed();
+  test_value_categories();
+  test_exceptions();
+  test_no_allocations();
+  test_deep_nesting();
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
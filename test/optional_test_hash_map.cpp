@@ -0,0 +1,131 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_hash_map.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <map>
+#include <string>
+
+using boost::optional;
+using boost::none;
+
+struct collide
+{
+  std::size_t operator()(int i) const { return static_cast<std::size_t>(i % 3); }
+};
+
+template <class Map>
+void check_against_std(Map& m, std::map<int, std::string> const& ref)
+{
+  BOOST_TEST_EQ(m.size(), ref.size());
+  for (int k = -5; k != 1005; ++k)
+  {
+    std::map<int, std::string>::const_iterator it = ref.find(k);
+    optional<std::string&> v = m.find(k);
+    BOOST_TEST_EQ(bool(v), it != ref.end());
+    if (v && it != ref.end())
+      BOOST_TEST_EQ(*v, it->second);
+  }
+
+  std::size_t n = 0;
+  m.for_each([&](int const& k, std::string const& v) { ++n; BOOST_TEST_EQ(ref.at(k), v); });
+  BOOST_TEST_EQ(n, ref.size());
+}
+
+template <class Map>
+void test_against_std()
+{
+  Map m;
+  std::map<int, std::string> ref;
+  BOOST_TEST(!m.find(1));
+
+  unsigned seed = 1;
+  for (int step = 0; step != 5000; ++step)
+  {
+    seed = seed * 1103515245u + 12345u;
+    int const k = int((seed >> 8) % 1000);
+    if ((seed >> 20) % 3 == 0)
+    {
+      BOOST_TEST_EQ(m.erase(k), ref.erase(k) == 1);
+    }
+    else
+    {
+      std::string const v = std::to_string(step);
+      BOOST_TEST_EQ(m.insert(k, v), ref.insert(std::make_pair(k, v)).second);
+    }
+  }
+  check_against_std(m, ref);
+
+  Map copy(m);
+  m.clear();
+  BOOST_TEST(m.empty());
+  BOOST_TEST(!m.find(ref.begin()->first));
+  check_against_std(copy, ref);
+
+  m = std::move(copy);
+  check_against_std(m, ref);
+}
+
+void test_map_interface()
+{
+  boost::optional_hash_map<std::string, int> m;
+  m["a"] = 1;
+  ++m["a"];
+  BOOST_TEST_EQ(*m.find("a"), 2);
+
+  std::pair<int&, bool> r = m.try_emplace("b", 5);
+  BOOST_TEST(r.second);
+  r = m.try_emplace("b", 6);
+  BOOST_TEST(!r.second);
+  BOOST_TEST_EQ(r.first, 5);
+
+  *m.find("b") = 7;
+  boost::optional_hash_map<std::string, int> const& cm = m;
+  optional<int const&> b = cm.find("b");
+  BOOST_TEST(b);
+  BOOST_TEST_EQ(*b, 7);
+  BOOST_TEST(!cm.find("c"));
+  BOOST_TEST(cm.contains("a"));
+
+  m.reserve(100);
+  BOOST_TEST_GE(m.capacity(), 100u);
+  BOOST_TEST_EQ(m.size(), 2u);
+  BOOST_TEST_EQ(*m.find("a"), 2);
+}
+
+void test_set()
+{
+  boost::optional_hash_set<std::string> s;
+  BOOST_TEST(s.insert("x"));
+  BOOST_TEST(!s.insert(std::string("x")));
+  for (int i = 0; i != 100; ++i)
+    s.insert(std::to_string(i));
+  BOOST_TEST_EQ(s.size(), 101u);
+  BOOST_TEST(s.find("x"));
+  BOOST_TEST_EQ(*s.find("42"), "42");
+  BOOST_TEST(s.erase("42"));
+  BOOST_TEST(!s.find("42"));
+
+  std::size_t n = 0;
+  s.for_each([&](std::string const&) { ++n; });
+  BOOST_TEST_EQ(n, 100u);
+}
+
+int main()
+{
+  test_against_std<boost::optional_hash_map<int, std::string> >();
+  test_against_std<boost::optional_hash_map<int, std::string, collide> >();
+  test_map_interface();
+  test_set();
+
+  return boost::report_errors();
+}
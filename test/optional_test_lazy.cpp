@@ -0,0 +1,120 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/lazy_optional.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct user_agent
+{
+  std::string raw;
+  int* evaluations;
+
+  std::string operator()() const
+  {
+    ++*evaluations;
+    return "parsed:" + raw;
+  }
+};
+
+void test_evaluated_once()
+{
+  int evaluations = 0;
+  boost::lazy_optional<std::string, user_agent> l(user_agent{"curl", &evaluations});
+  BOOST_TEST(l.is_pending());
+  BOOST_TEST(!l.has_value());
+  BOOST_TEST(!l.peek());
+  BOOST_TEST_EQ(evaluations, 0);
+
+  BOOST_TEST_EQ(*l, "parsed:curl");
+  BOOST_TEST_EQ(l->size(), 11u);
+  BOOST_TEST_EQ(l.value(), "parsed:curl");
+  BOOST_TEST_EQ(evaluations, 1);
+  BOOST_TEST(l.has_value());
+  BOOST_TEST(!l.is_pending());
+  BOOST_TEST_EQ(*l.peek(), "parsed:curl");
+
+  // the value is computed on first access through a const reference as well
+  boost::lazy_optional<std::string, user_agent> const c(user_agent{"wget", &evaluations});
+  BOOST_TEST_EQ(*c, "parsed:wget");
+  BOOST_TEST_EQ(*c.peek(), "parsed:wget");
+  BOOST_TEST_EQ(evaluations, 2);
+}
+
+void test_never_accessed()
+{
+  int evaluations = 0;
+  {
+    boost::lazy_optional<std::string, user_agent> l(user_agent{"never", &evaluations});
+  }
+  BOOST_TEST_EQ(evaluations, 0);
+}
+
+void test_shared_storage()
+{
+  std::int64_t k = 7;
+  auto l = boost::make_lazy([k] { return k * 6; });
+  BOOST_TEST_EQ(sizeof(l), 2 * sizeof(std::int64_t));
+  BOOST_TEST_EQ(*l, 42);
+}
+
+void test_copy_and_move()
+{
+  int evaluations = 0;
+  boost::lazy_optional<std::string, user_agent> a(user_agent{"a", &evaluations});
+  boost::lazy_optional<std::string, user_agent> b = a;
+  BOOST_TEST(b.is_pending());
+  BOOST_TEST_EQ(*a, "parsed:a");
+
+  boost::lazy_optional<std::string, user_agent> c = a;
+  BOOST_TEST(c.has_value());
+  BOOST_TEST_EQ(*c, "parsed:a");
+  BOOST_TEST_EQ(evaluations, 1);
+
+  boost::lazy_optional<std::string, user_agent> d = std::move(b);
+  BOOST_TEST_EQ(*d, "parsed:a");
+  BOOST_TEST_EQ(evaluations, 2);
+}
+
+void test_throwing_initializer()
+{
+  boost::lazy<std::vector<int> > l([]() -> std::vector<int> { throw std::runtime_error("no data"); });
+  BOOST_TEST(l.is_pending());
+  BOOST_TEST_THROWS(*l, std::runtime_error);
+  BOOST_TEST(!l.is_pending());
+  BOOST_TEST(!l.has_value());
+  BOOST_TEST_THROWS(l.value(), boost::bad_optional_access);
+}
+
+void test_type_erased()
+{
+  std::vector<boost::lazy<std::string> > fields;
+  fields.emplace_back([] { return std::string("header"); });
+  fields.emplace_back([] { return std::string(3, 'b'); });
+  BOOST_TEST_EQ(*fields[1], "bbb");
+  BOOST_TEST(!fields[0].has_value());
+}
+
+int main()
+{
+  test_evaluated_once();
+  test_never_accessed();
+  test_shared_storage();
+  test_copy_and_move();
+  test_throwing_initializer();
+  test_type_erased();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,126 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_mailbox.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using boost::optional;
+
+struct order
+{
+  int id;
+  std::unique_ptr<std::string> symbol;
+
+  order(int id, std::string const& symbol) : id(id), symbol(new std::string(symbol)) {}
+};
+
+void test_try_put_take()
+{
+  boost::optional_mailbox<order> m;
+  BOOST_TEST_EQ(alignof(boost::optional_mailbox<order>), 64u);
+  BOOST_TEST(!m.has_value());
+  BOOST_TEST(!m.try_take());
+
+  BOOST_TEST(m.try_put(1, "ABC"));
+  BOOST_TEST(m.has_value());
+  BOOST_TEST(!m.try_put(2, "XYZ"));
+
+  optional<order> o = m.try_take();
+  BOOST_TEST(o);
+  BOOST_TEST_EQ(o->id, 1);
+  BOOST_TEST_EQ(*o->symbol, "ABC");
+  BOOST_TEST(!m.has_value());
+  BOOST_TEST(!m.try_take());
+
+  BOOST_TEST(m.try_put(order(3, "DEF")));
+  // the destructor of the mailbox destroys the value left in it
+}
+
+void test_blocking()
+{
+  // the producer and the consumer alternate through put() and take();
+  // every value arrives, in order
+  int const n = 20000;
+  boost::optional_mailbox<std::vector<int> > m;
+  std::vector<int> received;
+
+  std::thread consumer([&m, &received]
+  {
+    for (int i = 0; i != n; ++i)
+    {
+      std::vector<int> v = m.take();
+      received.push_back(v.empty() ? -1 : v.front() + v.back());
+    }
+  });
+  for (int i = 0; i != n; ++i)
+    m.put(3, i);
+  consumer.join();
+
+  BOOST_TEST_EQ(received.size(), static_cast<std::size_t>(n));
+  int errors = 0;
+  for (int i = 0; i != n; ++i)
+    errors += received[i] != 2 * i;
+  BOOST_TEST_EQ(errors, 0);
+  BOOST_TEST(!m.has_value());
+}
+
+void test_polling()
+{
+  int const n = 20000;
+  boost::optional_mailbox<int> m;
+  long long sum = 0;
+
+  std::thread consumer([&m, &sum]
+  {
+    for (int taken = 0; taken != n;)
+      if (optional<int> v = m.try_take())
+      {
+        sum += *v;
+        ++taken;
+      }
+      else
+        std::this_thread::yield();
+  });
+  for (int i = 0; i != n;)
+    if (m.try_put(i))
+      ++i;
+    else
+      std::this_thread::yield();
+  consumer.join();
+
+  BOOST_TEST_EQ(sum, static_cast<long long>(n) * (n - 1) / 2);
+}
+
+int main()
+{
+  test_try_put_take();
+  test_blocking();
+  test_polling();
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
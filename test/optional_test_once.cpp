@@ -0,0 +1,157 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_once.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct config
+{
+  std::string name;
+  int version;
+
+  config(std::string name, int version) : name(name), version(version) {}
+  config(config const&) = delete;
+  config(config&&) = default;
+};
+
+struct counted_loader
+{
+  int* calls;
+
+  config operator()() const
+  {
+    ++*calls;
+    return config("main", 3);
+  }
+};
+
+void test_single_thread()
+{
+  int calls = 0;
+  boost::optional_once<config> o;
+  BOOST_TEST(!o.has_value());
+  BOOST_TEST(!o.get());
+
+  config& c = o.get_or_init(counted_loader{&calls});
+  BOOST_TEST_EQ(c.name, "main");
+  BOOST_TEST_EQ(c.version, 3);
+  BOOST_TEST(o.has_value());
+  BOOST_TEST_EQ(&*o.get(), &c);
+
+  BOOST_TEST_EQ(&o.get_or_init(counted_loader{&calls}), &c);
+  BOOST_TEST_EQ(calls, 1);
+
+  boost::optional_once<config> const& co = o;
+  BOOST_TEST_EQ(co.get()->version, 3);
+}
+
+struct widget
+{
+  boost::optional_once<std::string> label_;
+
+  std::string const& label() const
+  {
+    return label_.get_or_init([this] { return std::string("widget"); });
+  }
+};
+
+void test_const_member()
+{
+  widget const w;
+  BOOST_TEST_EQ(w.label(), "widget");
+  BOOST_TEST_EQ(&w.label(), &w.label());
+}
+
+void test_throwing_init()
+{
+  int attempts = 0;
+  boost::optional_once<std::string> o;
+
+  BOOST_TEST_THROWS(o.get_or_init([&attempts]() -> std::string { ++attempts; throw std::runtime_error("unavailable"); }),
+                    std::runtime_error);
+  BOOST_TEST(!o.has_value());
+
+  BOOST_TEST_EQ(o.get_or_init([&attempts] { ++attempts; return std::string("second"); }), "second");
+  BOOST_TEST_EQ(o.get_or_init([&attempts] { ++attempts; return std::string("third"); }), "second");
+  BOOST_TEST_EQ(attempts, 2);
+}
+
+void test_threads()
+{
+  // of the threads racing to initialize the value, the first attempt
+  // throws and exactly one of the others succeeds
+  std::atomic<int> attempts(0);
+  std::atomic<int> successes(0);
+  std::atomic<int> failures(0);
+  boost::optional_once<std::vector<int> > o;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t != 8; ++t)
+    threads.push_back(std::thread([&, t]
+    {
+      for (;;)
+      {
+        bool threw = true;
+        try
+        {
+          std::vector<int> const& v = o.get_or_init([&, t]
+          {
+            if (attempts++ == 0)
+              throw std::runtime_error("first attempt");
+            ++successes;
+            return std::vector<int>(1000, t);
+          });
+          if (v.size() != 1000 || v.front() != v.back())
+            ++failures;
+          threw = false;
+        }
+        catch (std::runtime_error const&)
+        {
+        }
+        if (!threw)
+          return;
+      }
+    }));
+  for (std::size_t t = 0; t != threads.size(); ++t)
+    threads[t].join();
+
+  BOOST_TEST_EQ(attempts.load(), 2);
+  BOOST_TEST_EQ(successes.load(), 1);
+  BOOST_TEST_EQ(failures.load(), 0);
+  BOOST_TEST(o.has_value());
+}
+
+int main()
+{
+  test_single_thread();
+  test_const_member();
+  test_throwing_init();
+  test_threads();
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,150 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_pack.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <string>
+#include <utility>
+
+using boost::optional;
+using boost::none;
+
+typedef boost::optional_pack<char, double, std::string, int> pack;
+
+struct separate
+{
+  optional<char> a;
+  optional<double> b;
+  optional<std::string> c;
+  optional<int> d;
+};
+
+struct counted
+{
+  static int alive;
+  int v;
+  explicit counted(int v) : v(v) { ++alive; }
+  counted(counted const& rhs) : v(rhs.v) { ++alive; }
+  ~counted() { --alive; }
+  counted& operator=(counted const& rhs) { v = rhs.v; return *this; }
+};
+
+int counted::alive = 0;
+
+void test_layout()
+{
+  BOOST_TEST_EQ(pack::offset<1>(), 0u);
+  BOOST_TEST_EQ(pack::offset<2>(), 8u);
+  BOOST_TEST_EQ(pack::offset<3>(), 8u + sizeof(std::string));
+  BOOST_TEST_EQ(pack::offset<0>(), 12u + sizeof(std::string));
+  BOOST_TEST_LT(sizeof(pack), sizeof(separate));
+
+  typedef boost::optional_pack<char, char, char, char, char, char, char, char, char> nine;
+  BOOST_TEST_EQ(sizeof(nine::mask_type), 2u);
+  BOOST_TEST_EQ(sizeof(nine), 12u);
+}
+
+void test_access()
+{
+  pack p;
+  BOOST_TEST_EQ(p.mask(), 0);
+  BOOST_TEST(!p.get<0>());
+  BOOST_TEST((!p.has_any<0, 1, 2, 3>()));
+
+  p.emplace<2>(3, 'x');
+  p.set<1>(2.5);
+  BOOST_TEST(p.has<2>());
+  BOOST_TEST_EQ(*p.get<2>(), "xxx");
+  BOOST_TEST_EQ(*p.get<1>(), 2.5);
+  BOOST_TEST((p.has_all<1, 2>()));
+  BOOST_TEST((!p.has_all<0, 2>()));
+  BOOST_TEST((p.has_any<0, 2>()));
+  BOOST_TEST_EQ(p.mask(), (pack::field_mask<1, 2>()));
+
+  *p.get<2>() += "y";
+  p.set<2>(std::string("z"));
+  BOOST_TEST_EQ(*p.get<2>(), "z");
+
+  pack const& cp = p;
+  optional<std::string const&> s = cp.get<2>();
+  BOOST_TEST(s);
+  BOOST_TEST_EQ(*s, "z");
+
+  p.set<1>(none);
+  BOOST_TEST(!p.has<1>());
+  p.reset();
+  BOOST_TEST_EQ(p.mask(), 0);
+}
+
+void test_set_optional()
+{
+  pack p;
+  optional<std::string> s("abc");
+  p.set<2>(s);
+  BOOST_TEST_EQ(*p.get<2>(), "abc");
+  BOOST_TEST_EQ(*s, "abc");
+
+  optional<std::string> const t("de");
+  p.set<2>(t);
+  BOOST_TEST_EQ(*p.get<2>(), "de");
+
+  p.set<2>(optional<std::string>("f"));
+  BOOST_TEST_EQ(*p.get<2>(), "f");
+
+  p.set<1>(optional<double>(1.5));
+  BOOST_TEST_EQ(*p.get<1>(), 1.5);
+
+  optional<std::string> empty;
+  p.set<2>(empty);
+  BOOST_TEST(!p.has<2>());
+  p.set<1>(optional<double>());
+  BOOST_TEST(!p.has<1>());
+  BOOST_TEST_EQ(p.mask(), 0);
+}
+
+void test_copy_and_move()
+{
+  typedef boost::optional_pack<counted, int, counted> cpack;
+  {
+    cpack a;
+    a.emplace<0>(1);
+    a.emplace<1>(2);
+
+    cpack b(a);
+    BOOST_TEST_EQ(counted::alive, 2);
+    BOOST_TEST_EQ(b.get<0>()->v, 1);
+    BOOST_TEST(!b.has<2>());
+
+    b.reset<0>();
+    b.emplace<2>(3);
+    a = b;
+    BOOST_TEST_EQ(counted::alive, 2);
+    BOOST_TEST(!a.has<0>());
+    BOOST_TEST_EQ(a.get<2>()->v, 3);
+
+    cpack c(std::move(a));
+    BOOST_TEST_EQ(c.get<2>()->v, 3);
+    c = c;
+    BOOST_TEST_EQ(c.mask(), (cpack::field_mask<1, 2>()));
+  }
+  BOOST_TEST_EQ(counted::alive, 0);
+}
+
+int main()
+{
+  test_layout();
+  test_access();
+  test_set_optional();
+  test_copy_and_move();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,217 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_parallel.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+std::vector<optional<int> > make_data(std::size_t n)
+{
+  std::vector<optional<int> > v(n);
+  for (std::size_t i = 0; i != n; ++i)
+    if (i % 3 != 0 && i % 7 != 2)
+      v[i] = static_cast<int>(i % 1000);
+  return v;
+}
+
+// The same data as `make_data(n)`, in the columnar layout.
+void make_columns(std::size_t n, std::vector<std::uint64_t>& bits, std::vector<int>& values)
+{
+  bits.assign((n + 63) / 64, 0);
+  values.assign(n, -1);
+  for (std::size_t i = 0; i != n; ++i)
+    if (i % 3 != 0 && i % 7 != 2)
+    {
+      bits[i / 64] |= std::uint64_t(1) << (i % 64);
+      values[i] = static_cast<int>(i % 1000);
+    }
+}
+
+boost::parallel_chunks const policies[] = {
+  boost::parallel_chunks(1),
+  boost::parallel_chunks(4, 64),
+  boost::parallel_chunks(3, 1000),
+  boost::parallel_chunks(0)
+};
+
+void test_interleaved()
+{
+  std::size_t const n = 100003;
+  std::vector<optional<int> > data = make_data(n);
+  optional<int> const* first = data.data();
+  optional<int> const* last = data.data() + n;
+
+  std::int64_t expected_sum = 0;
+  std::size_t expected_present = 0, expected_odd = 0;
+  for (std::size_t i = 0; i != n; ++i)
+    if (data[i])
+    {
+      expected_sum += *data[i];
+      ++expected_present;
+      expected_odd += *data[i] % 2;
+    }
+
+  for (boost::parallel_chunks const& p : policies)
+  {
+    std::atomic<std::int64_t> sum(0);
+    boost::for_each_present(p, first, last, [&sum](int v) { sum += v; });
+    BOOST_TEST_EQ(sum.load(), expected_sum);
+
+    BOOST_TEST_EQ(boost::reduce_present(p, first, last, std::int64_t(0),
+                                        [](std::int64_t a, std::int64_t b) { return a + b; }), expected_sum);
+    BOOST_TEST_EQ(boost::transform_reduce_present(p, first, last, std::size_t(0),
+                                                  [](std::size_t a, std::size_t b) { return a + b; },
+                                                  [](int) { return std::size_t(1); }), expected_present);
+    BOOST_TEST_EQ(boost::count_present_if(p, first, last, [](int v) { return v % 2 == 1; }), expected_odd);
+
+    std::vector<optional<std::int64_t> > out(n, std::int64_t(-5));
+    BOOST_TEST(boost::transform_present(p, first, last, out.data(), [](int v) { return std::int64_t(v) * 2; })
+               == out.data() + n);
+    int errors = 0;
+    for (std::size_t i = 0; i != n; ++i)
+      errors += data[i] ? (!out[i] || *out[i] != 2 * *data[i]) : bool(out[i]);
+    BOOST_TEST_EQ(errors, 0);
+  }
+}
+
+void test_in_place_modification()
+{
+  std::vector<optional<int> > data = make_data(5000);
+  boost::for_each_present(boost::parallel_chunks(4, 128), data.data(), data.data() + data.size(), [](int& v) { v += 1; });
+  std::vector<optional<int> > const expected = make_data(5000);
+  int errors = 0;
+  for (std::size_t i = 0; i != data.size(); ++i)
+    errors += expected[i] ? *data[i] != *expected[i] + 1 : bool(data[i]);
+  BOOST_TEST_EQ(errors, 0);
+}
+
+void test_order_of_reduction()
+{
+  // concatenation is associative but not commutative
+  std::vector<optional<std::string> > words(1000);
+  std::string expected = ">";
+  for (std::size_t i = 0; i != words.size(); ++i)
+    if (i % 5 != 0)
+    {
+      words[i] = std::to_string(i % 10);
+      expected += *words[i];
+    }
+
+  std::string const r = boost::reduce_present(boost::parallel_chunks(4, 64), words.data(), words.data() + words.size(),
+                                              std::string(">"), [](std::string a, std::string const& b) { return a + b; });
+  BOOST_TEST_EQ(r, expected);
+}
+
+void test_bitmap_span()
+{
+  std::size_t const n = 70001;
+  std::vector<std::uint64_t> bits;
+  std::vector<int> values;
+  make_columns(n, bits, values);
+  boost::optional_bitmap_span<const int> col(bits.data(), values.data(), n);
+
+  std::vector<optional<int> > const data = make_data(n);
+  std::int64_t expected_sum = 0;
+  std::size_t expected_big = 0;
+  for (std::size_t i = 0; i != n; ++i)
+    if (data[i])
+    {
+      expected_sum += *data[i];
+      expected_big += *data[i] >= 500;
+    }
+
+  for (boost::parallel_chunks const& p : policies)
+  {
+    std::atomic<std::int64_t> sum(0);
+    boost::for_each_present(p, col, [&sum](int v) { sum += v; });
+    BOOST_TEST_EQ(sum.load(), expected_sum);
+
+    BOOST_TEST_EQ(boost::reduce_present(p, col, std::int64_t(0),
+                                        [](std::int64_t a, std::int64_t b) { return a + b; }), expected_sum);
+    BOOST_TEST_EQ(boost::count_present_if(p, col, [](int v) { return v >= 500; }), expected_big);
+
+    std::vector<std::uint64_t> out_bits(bits.size(), ~std::uint64_t(0));
+    std::vector<double> out_values(n, 0.0);
+    boost::optional_bitmap_span<double> out(out_bits.data(), out_values.data(), n);
+    boost::transform_present(p, col, out, [](int v) { return v / 2.0; });
+    int errors = 0;
+    for (std::size_t i = 0; i != n; ++i)
+      errors += data[i] ? (!out.has_value(i) || out.value(i) != *data[i] / 2.0) : out.has_value(i);
+    BOOST_TEST_EQ(errors, 0);
+  }
+
+  // a mutable span
+  boost::optional_bitmap_span<int> mcol(bits.data(), values.data(), n);
+  boost::for_each_present(boost::parallel_chunks(2, 256), mcol, [](int& v) { v = -v; });
+  BOOST_TEST_EQ(boost::reduce_present(boost::parallel_chunks(1), mcol, std::int64_t(0),
+                                      [](std::int64_t a, std::int64_t b) { return a + b; }), -expected_sum);
+}
+
+void test_empty_ranges()
+{
+  std::vector<optional<int> > none_present(300);
+  BOOST_TEST_EQ(boost::reduce_present(boost::parallel_chunks(4, 64), none_present.data(),
+                                      none_present.data() + none_present.size(), 7,
+                                      [](int a, int b) { return a + b; }), 7);
+  optional<int> const* p = nullptr;
+  BOOST_TEST_EQ(boost::count_present_if(boost::parallel_chunks(4), p, p, [](int) { return true; }), 0u);
+}
+
+struct body_error {};
+
+void test_exceptions()
+{
+  std::vector<optional<int> > data = make_data(10000);
+  optional<int> const* first = data.data();
+  optional<int> const* last = data.data() + data.size();
+
+  // the serial and the threaded plans report the exception alike
+  for (boost::parallel_chunks const& p : policies)
+  {
+    std::atomic<int> calls(0);
+    BOOST_TEST_THROWS(boost::for_each_present(p, first, last, [&calls](int const& v)
+    {
+      ++calls;
+      if (v == 500)
+        throw body_error();
+    }), body_error);
+    BOOST_TEST_LT(calls.load(), 10000);
+
+    BOOST_TEST_THROWS(boost::reduce_present(p, first, last, 0, [](int a, int b)
+    {
+      if (b == 998)
+        throw body_error();
+      return a + b;
+    }), body_error);
+  }
+
+  // the algorithms can be used again
+  BOOST_TEST_GT(boost::count_present_if(boost::parallel_chunks(4, 64), first, last, [](int v) { return v > 0; }), 0u);
+}
+
+int main()
+{
+  test_interleaved();
+  test_in_place_modification();
+  test_order_of_reduction();
+  test_bitmap_span();
+  test_empty_ranges();
+  test_exceptions();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,178 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_pool.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <thread>
+#endif
+
+using boost::optional;
+
+struct counted
+{
+  static int alive;
+  int v;
+  explicit counted(int v) : v(v)
+  {
+    if (v < 0)
+      throw std::runtime_error("counted");
+    ++alive;
+  }
+  ~counted() { --alive; }
+};
+
+int counted::alive = 0;
+
+void test_pool()
+{
+  {
+    boost::optional_pool<counted> pool(3);
+    BOOST_TEST_EQ(pool.capacity(), 3u);
+
+    optional<counted&> a = pool.acquire(1);
+    optional<counted&> b = pool.acquire(2);
+    optional<counted&> c = pool.acquire(3);
+    BOOST_TEST(a && b && c);
+    BOOST_TEST(pool.full());
+    BOOST_TEST(!pool.acquire(4));
+    BOOST_TEST_EQ(counted::alive, 3);
+    BOOST_TEST(pool.owns(*b));
+
+    pool.release(*b);
+    BOOST_TEST_EQ(counted::alive, 2);
+    BOOST_TEST_EQ(pool.size(), 2u);
+
+    BOOST_TEST_THROWS(pool.acquire(-1), std::runtime_error);
+    BOOST_TEST_EQ(pool.size(), 2u);
+
+    optional<counted&> d = pool.acquire(5);
+    BOOST_TEST(d);
+    BOOST_TEST_EQ(&*d, &*b);
+    BOOST_TEST_EQ(d->v, 5);
+    BOOST_TEST_EQ(a->v, 1);
+
+    counted outside(0);
+    BOOST_TEST(!pool.owns(outside));
+    pool.release(*a);
+  }
+  // the objects not released are destroyed with the pool
+  BOOST_TEST_EQ(counted::alive, 0);
+}
+
+void test_small_values()
+{
+  boost::optional_pool<char> pool(1000);
+  std::vector<char*> ps;
+  for (int i = 0; i != 1000; ++i)
+    ps.push_back(&*pool.acquire(char(i)));
+  BOOST_TEST(pool.full());
+  for (int i = 0; i < 1000; i += 2)
+    pool.release(*ps[i]);
+  for (int i = 1; i < 1000; i += 2)
+    BOOST_TEST_EQ(*ps[i], char(i));
+  BOOST_TEST_EQ(pool.size(), 500u);
+}
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+void test_concurrent_pool()
+{
+  {
+    boost::concurrent_optional_pool<counted> pool(2);
+    optional<counted&> a = pool.acquire(1);
+    BOOST_TEST_THROWS(pool.acquire(-1), std::runtime_error);
+    optional<counted&> b = pool.acquire(2);
+    BOOST_TEST(a && b);
+    BOOST_TEST(!pool.acquire(3));
+    pool.release(*a);
+    BOOST_TEST_EQ(counted::alive, 1);
+    BOOST_TEST(pool.acquire(4));
+  }
+  BOOST_TEST_EQ(counted::alive, 0);
+}
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+
+void test_concurrent_threads()
+{
+  boost::concurrent_optional_pool<std::string> pool(16);
+  std::vector<std::thread> threads;
+  std::vector<int> errors(4, 0);
+  for (int t = 0; t != 4; ++t)
+    threads.push_back(std::thread([&pool, &errors, t]
+    {
+      std::string const s(40, char('a' + t)); // longer than the small-string buffer
+      for (int i = 0; i != 20000; ++i)
+      {
+        optional<std::string&> o = pool.acquire(s);
+        if (!o)
+          continue;
+        if (*o != s)
+          ++errors[t];
+        pool.release(*o);
+      }
+    }));
+  for (std::size_t t = 0; t != threads.size(); ++t)
+    threads[t].join();
+
+  for (int t = 0; t != 4; ++t)
+    BOOST_TEST_EQ(errors[t], 0);
+
+  std::vector<std::string*> all;
+  for (optional<std::string&> o; (o = pool.acquire("x")); )
+    all.push_back(&*o);
+  BOOST_TEST_EQ(all.size(), 16u);
+}
+
+#else
+
+void test_concurrent_threads() {}
+
+#endif
+
+#else
+
+void test_concurrent_pool() {}
+void test_concurrent_threads() {}
+
+#endif
+
+void test_max_size()
+{
+  BOOST_TEST_EQ(boost::optional_pool<int>::max_size(), std::uint32_t(-1));
+  std::size_t const too_many = boost::optional_pool<int>::max_size() + 1;
+  if (too_many != 0)
+  {
+    BOOST_TEST_THROWS((void)boost::optional_pool<int>(too_many), std::length_error);
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+    BOOST_TEST_THROWS((void)boost::concurrent_optional_pool<int>(too_many), std::length_error);
+#endif
+  }
+}
+
+int main()
+{
+  test_pool();
+  test_small_values();
+  test_concurrent_pool();
+  test_concurrent_threads();
+  test_max_size();
+
+  return boost::report_errors();
+}
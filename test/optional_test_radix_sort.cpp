@@ -0,0 +1,147 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_radix_sort.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+enum class color : short { red = -3, green = 0, blue = 7 };
+
+template <class T>
+std::vector<optional<T> > make_column(std::size_t n, unsigned seed)
+{
+  std::vector<optional<T> > ans;
+  std::uint64_t s = seed;
+  for (std::size_t i = 0; i != n; ++i)
+  {
+    s = s * 6364136223846793005ull + 1442695040888963407ull;
+    if ((s >> 60) % 5 == 0)
+      ans.push_back(none);
+    else
+      ans.push_back(static_cast<T>(static_cast<std::int64_t>(s >> 3) % 1000 - 500));
+  }
+  return ans;
+}
+
+template <class T>
+void test_sort(std::vector<optional<T> > v)
+{
+  std::vector<optional<T> > expected = v;
+  std::stable_sort(expected.begin(), expected.end());
+  boost::radix_sort_optionals(v.begin(), v.end());
+  BOOST_TEST(v == expected);
+}
+
+template <class T>
+void test_keys(std::vector<optional<T> > const& v)
+{
+  for (std::size_t i = 0; i + 1 < v.size(); ++i)
+  {
+    if (v[i] < v[i + 1])
+      BOOST_TEST(boost::encode_radix_key(v[i]) < boost::encode_radix_key(v[i + 1]));
+    if (v[i + 1] < v[i])
+      BOOST_TEST(boost::encode_radix_key(v[i + 1]) < boost::encode_radix_key(v[i]));
+  }
+}
+
+void test_extremes()
+{
+  std::vector<optional<std::int32_t> > v = {
+    std::numeric_limits<std::int32_t>::max(), none, std::numeric_limits<std::int32_t>::min(), 0, -1, none };
+  test_keys(v);
+  test_sort(v);
+
+  std::vector<optional<double> > d = {
+    1.5, none, -std::numeric_limits<double>::infinity(), -0.5, 0.0,
+    std::numeric_limits<double>::infinity(), -1e300, none };
+  test_keys(d);
+  test_sort(d);
+
+  BOOST_TEST(boost::encode_radix_key(optional<std::int8_t>()) < boost::encode_radix_key(optional<std::int8_t>(-128)));
+}
+
+void test_key_size()
+{
+  BOOST_TEST_EQ(sizeof(boost::optional_radix_key<std::int64_t>::type), 16u);
+  BOOST_TEST_EQ(sizeof(boost::optional_radix_key<double>::type), 16u);
+  BOOST_TEST_EQ(sizeof(boost::optional_radix_key<std::uint16_t>::type), 4u);
+  BOOST_TEST_EQ(sizeof(boost::optional_radix_key<std::uint8_t>::type), 2u);
+
+  // the presence flag is the bit above the value
+  BOOST_TEST_EQ(boost::encode_radix_key(optional<std::uint8_t>()), 0u);
+  BOOST_TEST_EQ(boost::encode_radix_key(optional<std::uint8_t>(0)), 0x100u);
+  BOOST_TEST_EQ(boost::encode_radix_key(optional<std::uint8_t>(255)), 0x1ffu);
+  BOOST_TEST_EQ(boost::encode_radix_key(optional<std::int32_t>(0)), 0x180000000ull);
+
+  boost::radix_key128 const k = boost::encode_radix_key(optional<std::uint64_t>(7));
+  BOOST_TEST_EQ(k.high, 1u);
+  BOOST_TEST_EQ(k.low, 7u);
+  BOOST_TEST(boost::encode_radix_key(optional<std::uint64_t>()) == boost::radix_key128());
+
+  std::vector<optional<std::int64_t> > v = {
+    std::numeric_limits<std::int64_t>::max(), none, std::numeric_limits<std::int64_t>::min(), -1, 0 };
+  test_keys(v);
+  test_sort(v);
+}
+
+void test_signed_zeros()
+{
+  BOOST_TEST(boost::encode_radix_key(optional<float>(-0.0f)) == boost::encode_radix_key(optional<float>(0.0f)));
+  BOOST_TEST(boost::encode_radix_key(optional<double>(-0.0)) == boost::encode_radix_key(optional<double>(0.0)));
+
+  // stability: the zeros compare equal, so they keep their order
+  std::vector<optional<float> > v = { 0.0f, -0.0f, 1.0f, none, -0.0f };
+  boost::radix_sort_optionals(v.begin(), v.end());
+  BOOST_TEST(!v[0]);
+  BOOST_TEST(!std::signbit(*v[1]));
+  BOOST_TEST(std::signbit(*v[2]));
+  BOOST_TEST(std::signbit(*v[3]));
+  BOOST_TEST_EQ(*v[4], 1.0f);
+}
+
+void test_columns()
+{
+  for (unsigned s = 0; s != 10; ++s)
+  {
+    test_sort(make_column<std::int64_t>(500, s));
+    test_sort(make_column<std::uint64_t>(500, s));
+    test_sort(make_column<std::int16_t>(300, s));
+    test_sort(make_column<std::int8_t>(300, s));
+    test_sort(make_column<float>(300, s));
+    test_sort(make_column<double>(300, s));
+
+    std::vector<optional<int> > ints = make_column<int>(100, s);
+    test_keys(ints);
+  }
+
+  std::vector<optional<color> > colors = { color::blue, none, color::red, color::green, color::red };
+  test_sort(colors);
+  test_sort(std::vector<optional<int> >());
+  test_sort(std::vector<optional<int> >(3));
+}
+
+int main()
+{
+  test_extremes();
+  test_key_size();
+  test_signed_zeros();
+  test_columns();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,165 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/rcu_optional.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+struct config
+{
+  static std::atomic<int> alive;
+
+  int generation;
+  std::vector<int> limits;
+
+  explicit config(int g) : generation(g), limits(8, g) { ++alive; }
+  config(config const& rhs) : generation(rhs.generation), limits(rhs.limits) { ++alive; }
+  ~config() { --alive; generation = -1; }
+
+  bool consistent() const { return limits.size() == 8 && limits.front() == generation && limits.back() == generation; }
+};
+
+std::atomic<int> config::alive(0);
+
+typedef boost::rcu_optional<config> rcu_config;
+
+void test_single_thread()
+{
+  {
+    rcu_config c(4);
+    BOOST_TEST_EQ(c.max_readers(), 4u);
+    rcu_config::reader r(c);
+
+    BOOST_TEST(!r.read());
+    BOOST_TEST(!r.read().get());
+
+    c.emplace(1);
+    {
+      rcu_config::read_guard g = r.read();
+      BOOST_TEST(g);
+      BOOST_TEST_EQ(g->generation, 1);
+      BOOST_TEST_EQ(g.get()->generation, 1);
+
+      // the value seen by a read survives a replacement
+      c.emplace(2);
+      BOOST_TEST_EQ((*g).generation, 1);
+      BOOST_TEST_EQ(config::alive.load(), 2);
+
+      {
+        rcu_config::read_guard inner = r.read();
+        BOOST_TEST_EQ(inner->generation, 2);
+      }
+      BOOST_TEST_EQ(c.collect(), 1u);
+      BOOST_TEST_EQ(g->generation, 1);
+    }
+    BOOST_TEST_EQ(c.collect(), 0u);
+    BOOST_TEST_EQ(config::alive.load(), 1);
+
+    c.store(optional<config>(config(3)));
+    BOOST_TEST_EQ(r.read()->generation, 3);
+    c.reset();
+    BOOST_TEST(!r.read());
+    BOOST_TEST_EQ(config::alive.load(), 0);
+
+    c.store(config(4));
+  }
+  BOOST_TEST_EQ(config::alive.load(), 0);
+}
+
+void test_reader_slots()
+{
+  rcu_config c(config(0), 2);
+  rcu_config::reader r1(c);
+  {
+    rcu_config::reader r2(c);
+    BOOST_TEST_THROWS(rcu_config::reader r3(c), std::length_error);
+  }
+  rcu_config::reader r3(c);
+  BOOST_TEST_EQ(r3.read()->generation, 0);
+}
+
+void test_threads()
+{
+  // readers keep checking the value they see while a writer replaces it;
+  // a value destroyed too early would be seen as inconsistent
+  {
+    rcu_config c(config(0), 8);
+    std::atomic<bool> done(false);
+    std::atomic<int> errors(0);
+    std::atomic<long> reads(0);
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t != 3; ++t)
+      readers.push_back(std::thread([&]
+      {
+        rcu_config::reader r(c);
+        int last = 0;
+        while (!done.load())
+        {
+          rcu_config::read_guard g = r.read();
+          if (g)
+          {
+            if (!g->consistent() || g->generation < last)
+              ++errors;
+            last = g->generation;
+          }
+          ++reads;
+          std::this_thread::yield();
+        }
+      }));
+
+    for (int g = 1; g != 2000; ++g)
+    {
+      if (g % 10 == 0)
+        c.reset();
+      else
+        c.emplace(g);
+      std::this_thread::yield();
+    }
+    done = true;
+    for (std::size_t t = 0; t != readers.size(); ++t)
+      readers[t].join();
+
+    BOOST_TEST_EQ(errors.load(), 0);
+    BOOST_TEST_GT(reads.load(), 0);
+    BOOST_TEST_EQ(c.collect(), 0u);
+    BOOST_TEST_EQ(config::alive.load(), 1);
+  }
+  BOOST_TEST_EQ(config::alive.load(), 0);
+}
+
+int main()
+{
+  test_single_thread();
+  test_reader_slots();
+  test_threads();
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,130 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_result_cache.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <stdexcept>
+#include <string>
+
+using boost::optional;
+using boost::none;
+
+typedef boost::optional_result_cache<int, std::string> cache_type;
+
+void test_find_and_insert()
+{
+  cache_type c(4, 4);
+  BOOST_TEST(!c.find(1));
+
+  c.insert(1, std::string("one"));
+  c.insert(2, none);
+  BOOST_TEST_EQ(c.positive_size(), 1u);
+  BOOST_TEST_EQ(c.negative_size(), 1u);
+
+  optional<optional<std::string const&> > r = c.find(1);
+  BOOST_TEST(r);
+  BOOST_TEST(*r);
+  BOOST_TEST_EQ(**r, "one");
+
+  r = c.find(2);
+  BOOST_TEST(r);
+  BOOST_TEST(!*r);
+
+  // a result replaces the previous one of the other kind
+  c.insert(2, optional<std::string>("two"));
+  c.insert(1, optional<std::string>());
+  BOOST_TEST_EQ(c.positive_size(), 1u);
+  BOOST_TEST_EQ(c.negative_size(), 1u);
+  BOOST_TEST_EQ(**c.find(2), "two");
+  BOOST_TEST(!*c.find(1));
+
+  c.insert(2, std::string("deux"));
+  BOOST_TEST_EQ(**c.find(2), "deux");
+  BOOST_TEST_EQ(c.size(), 2u);
+
+  BOOST_TEST(c.erase(1));
+  BOOST_TEST(!c.find(1));
+  c.clear();
+  BOOST_TEST(c.empty());
+}
+
+void test_clock_eviction()
+{
+  cache_type c(3, 2);
+  c.insert(1, std::string("a"));
+  c.insert(2, std::string("b"));
+  c.insert(3, std::string("c"));
+  c.find(1);
+  c.find(3);
+
+  // 2 is the only entry not used since insertion
+  c.insert(4, std::string("d"));
+  BOOST_TEST_EQ(c.positive_size(), 3u);
+  BOOST_TEST(!c.find(2));
+  BOOST_TEST(c.find(1));
+  BOOST_TEST(c.find(3));
+  BOOST_TEST(c.find(4));
+
+  for (int i = 10; i != 20; ++i)
+    c.insert(i, none);
+  BOOST_TEST_EQ(c.negative_size(), 2u);
+  BOOST_TEST_EQ(c.positive_size(), 3u);
+
+  for (int i = 100; i != 1000; ++i)
+  {
+    c.insert(i, std::to_string(i));
+    BOOST_TEST_EQ(**c.find(i), std::to_string(i));
+  }
+  BOOST_TEST_EQ(c.positive_size(), 3u);
+}
+
+void test_find_or_load()
+{
+  cache_type c(8, 8);
+  int calls = 0;
+  auto load = [&](int k) -> optional<std::string>
+  {
+    ++calls;
+    return k % 2 ? optional<std::string>(std::to_string(k)) : optional<std::string>();
+  };
+
+  for (int round = 0; round != 3; ++round)
+    for (int k = 0; k != 6; ++k)
+    {
+      optional<std::string const&> v = c.find_or_load(k, load);
+      BOOST_TEST_EQ(bool(v), k % 2 == 1);
+      if (v)
+        BOOST_TEST_EQ(*v, std::to_string(k));
+    }
+  BOOST_TEST_EQ(calls, 6);
+  BOOST_TEST_EQ(c.negative_size(), 3u);
+}
+
+void test_zero_capacity()
+{
+  BOOST_TEST_THROWS(cache_type(0, 8), std::invalid_argument);
+
+  cache_type c(2, 0);
+  c.insert(1, none);
+  BOOST_TEST(!c.find(1));
+  BOOST_TEST_EQ(*c.find_or_load(2, [](int) { return optional<std::string>("two"); }), "two");
+}
+
+int main()
+{
+  test_find_and_insert();
+  test_clock_eviction();
+  test_find_or_load();
+  test_zero_capacity();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_ring.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using boost::optional;
+
+// Compares the bitmap queries to the results of a slot-by-slot scan.
+template <class Ring>
+void check_queries(Ring const& r)
+{
+  std::size_t const n = Ring::capacity();
+  std::size_t count = 0;
+  for (std::size_t i = 0; i != n; ++i)
+    count += r.has_value(i);
+  BOOST_TEST_EQ(r.count(), count);
+
+  std::size_t run = 0;
+  while (run != n && r.has_value(run))
+    ++run;
+  BOOST_TEST_EQ(r.front_run(), run);
+
+  for (std::size_t i = 0; i <= n; ++i)
+  {
+    std::size_t j = i;
+    while (j < n && !r.has_value(j))
+      ++j;
+    BOOST_TEST_EQ(r.next_present(i), j);
+  }
+}
+
+void test_reorder()
+{
+  boost::optional_ring<std::string, 100> r;
+  std::vector<std::string> delivered;
+  std::uint64_t next_seq = 0;
+
+  // packets arrive out of order; deliver them in order as soon as possible
+  unsigned seed = 7;
+  std::vector<std::uint64_t> pending;
+  for (std::uint64_t s = 0; s != 1000; ++s)
+    pending.push_back(s);
+  while (!pending.empty())
+  {
+    seed = seed * 1103515245u + 12345u;
+    std::size_t k = std::min<std::size_t>(pending.size() - 1, (seed >> 16) % 50);
+    if (pending[k] - r.base() >= r.capacity())
+      k = 0; // the oldest missing packet is always at the front of the window
+    std::uint64_t const seq = pending[k];
+    pending.erase(pending.begin() + static_cast<std::ptrdiff_t>(k));
+
+    r.emplace(static_cast<std::size_t>(seq - r.base()), std::to_string(seq));
+    check_queries(r);
+    r.drain([&](std::string&& s) { delivered.push_back(std::move(s)); });
+    BOOST_TEST(!r.has_value(0));
+    next_seq = r.base();
+  }
+
+  BOOST_TEST_EQ(next_seq, 1000u);
+  BOOST_TEST_EQ(delivered.size(), 1000u);
+  for (std::size_t i = 0; i != delivered.size(); ++i)
+    BOOST_TEST_EQ(delivered[i], std::to_string(i));
+  BOOST_TEST_EQ(r.count(), 0u);
+}
+
+void test_access_and_advance()
+{
+  boost::optional_ring<std::string, 70> r;
+  r.emplace(3, "three");
+  r.emplace(65, "sixty-five");
+  BOOST_TEST(!r[0]);
+  BOOST_TEST_EQ(*r[3], "three");
+  BOOST_TEST_EQ(r.next_present(4), 65u);
+  check_queries(r);
+
+  r.advance(4);
+  BOOST_TEST_EQ(r.base(), 4u);
+  BOOST_TEST_EQ(r.count(), 1u);
+  BOOST_TEST_EQ(*r[61], "sixty-five");
+  r.emplace(68, "wrapped");
+  check_queries(r);
+
+  boost::optional_ring<std::string, 70> copy(r);
+  r.reset(61);
+  BOOST_TEST_EQ(r.next_present(0), 68u);
+  BOOST_TEST_EQ(*copy[61], "sixty-five");
+  check_queries(copy);
+
+  r = copy;
+  BOOST_TEST_EQ(r.count(), 2u);
+
+  r.advance(200);
+  BOOST_TEST_EQ(r.base(), 204u);
+  BOOST_TEST_EQ(r.count(), 0u);
+  for (std::size_t i = 0; i != 70; ++i)
+    r.emplace(i, "x");
+  BOOST_TEST_EQ(r.front_run(), 70u);
+  check_queries(r);
+  BOOST_TEST_EQ(r.drain([](std::string&&) {}), 70u);
+  BOOST_TEST_EQ(r.base(), 274u);
+}
+
+int main()
+{
+  test_reorder();
+  test_access_and_advance();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,133 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/rle_optional_sequence.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <string>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+std::vector<optional<int> > make_gappy()
+{
+  std::vector<optional<int> > ans;
+  for (int burst = 0; burst != 20; ++burst)
+  {
+    for (int i = 0; i != burst % 4 + 1; ++i)
+      ans.push_back(burst * 10 + i);
+    ans.resize(ans.size() + std::size_t(burst * 7));
+  }
+  return ans;
+}
+
+void test_random_access()
+{
+  std::vector<optional<int> > dense = make_gappy();
+  boost::rle_optional_sequence<int> seq(dense.begin(), dense.end());
+
+  BOOST_TEST_EQ(seq.size(), dense.size());
+  BOOST_TEST_EQ(seq.run_count(), 38u); // the first two bursts are adjacent
+  for (std::size_t i = 0; i != dense.size(); ++i)
+  {
+    BOOST_TEST_EQ(bool(seq[i]), bool(dense[i]));
+    if (dense[i])
+      BOOST_TEST_EQ(*seq[i], *dense[i]);
+  }
+}
+
+void test_iteration()
+{
+  std::vector<optional<int> > dense = make_gappy();
+  boost::rle_optional_sequence<int> seq(dense.begin(), dense.end());
+
+  std::size_t i = 0;
+  for (boost::rle_optional_sequence<int>::const_iterator it = seq.begin(); it != seq.end(); ++it, ++i)
+  {
+    BOOST_TEST_EQ(it.index(), i);
+    BOOST_TEST_EQ(bool(*it), bool(dense[i]));
+    if (dense[i])
+      BOOST_TEST_EQ(**it, *dense[i]);
+  }
+  BOOST_TEST_EQ(i, dense.size());
+
+  for (std::size_t k = 0; k < dense.size(); k += 13)
+  {
+    boost::rle_optional_sequence<int>::const_iterator it = seq.seek(k);
+    BOOST_TEST_EQ(it.index(), k);
+    BOOST_TEST_EQ(bool(*it), bool(dense[k]));
+    ++it;
+    if (k + 1 < dense.size())
+      BOOST_TEST_EQ(bool(*it), bool(dense[k + 1]));
+  }
+  BOOST_TEST(seq.seek(seq.size()) == seq.end());
+
+  std::size_t runs = 0;
+  for (boost::rle_optional_sequence<int>::const_iterator it = seq.begin(); it != seq.end(); it.next_run())
+    ++runs;
+  BOOST_TEST_EQ(runs, seq.run_count());
+}
+
+void test_reductions()
+{
+  std::vector<optional<int> > dense = make_gappy();
+  boost::rle_optional_sequence<int> seq(dense.begin(), dense.end());
+
+  long expected = 0;
+  for (std::size_t i = 0; i != dense.size(); ++i)
+    expected += dense[i].value_or(0);
+  BOOST_TEST_EQ(seq.reduce_present(0L, [](long a, int b) { return a + b; }), expected);
+
+  std::size_t present = 0;
+  seq.for_each_present_run([&](std::size_t first, int const* b, int const* e) {
+    for (; b != e; ++b, ++first, ++present)
+      BOOST_TEST(dense[first] == *b);
+  });
+  BOOST_TEST_EQ(present, seq.count());
+}
+
+void test_append()
+{
+  boost::rle_optional_sequence<std::string> seq;
+  BOOST_TEST(seq.empty());
+  BOOST_TEST(seq.begin() == seq.end());
+
+  seq.append_none(0);
+  BOOST_TEST_EQ(seq.run_count(), 0u);
+  seq.push_back(std::string("a"));
+  seq.emplace_back(2, 'b');
+  seq.push_back(none);
+  seq.append_none(1000000);
+  seq.push_back(optional<std::string>("c"));
+
+  BOOST_TEST_EQ(seq.size(), 1000004u);
+  BOOST_TEST_EQ(seq.count(), 3u);
+  BOOST_TEST_EQ(seq.run_count(), 3u);
+  BOOST_TEST_EQ(*seq[1], "bb");
+  BOOST_TEST(!seq[500000]);
+  BOOST_TEST_EQ(*seq[1000003], "c");
+
+  boost::rle_optional_sequence<std::string> other;
+  swap(seq, other);
+  BOOST_TEST(seq.empty());
+  BOOST_TEST_EQ(other.count(), 3u);
+}
+
+int main()
+{
+  test_random_access();
+  test_iteration();
+  test_reductions();
+  test_append();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,120 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/seqlock_optional.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#ifndef BOOST_NO_CXX11_HDR_ATOMIC
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+// All the fields of a consistent snapshot are equal.
+struct snapshot
+{
+  unsigned fields[37];
+
+  explicit snapshot(unsigned v)
+  {
+    for (unsigned& f : fields)
+      f = v;
+  }
+
+  bool consistent() const
+  {
+    for (unsigned f : fields)
+      if (f != fields[0])
+        return false;
+    return true;
+  }
+};
+
+void test_single_thread()
+{
+  boost::seqlock_optional<snapshot> s;
+  BOOST_TEST(!s.try_read());
+  BOOST_TEST_EQ(s.version(), 0u);
+
+  s.store(snapshot(3));
+  optional<snapshot> r = s.try_read();
+  BOOST_TEST(r);
+  BOOST_TEST(r->consistent());
+  BOOST_TEST_EQ(r->fields[36], 3u);
+  BOOST_TEST(s.has_value());
+  BOOST_TEST_EQ(s.version(), 1u);
+
+  s.reset();
+  BOOST_TEST(!s.has_value());
+  BOOST_TEST_EQ(s.version(), 2u);
+
+  boost::seqlock_optional<char> c('x');
+  BOOST_TEST_EQ(*c.try_read(), 'x');
+}
+
+void test_concurrent_readers()
+{
+  boost::seqlock_optional<snapshot> s(snapshot(0));
+  std::atomic<bool> done(false);
+  std::vector<int> errors(3, 0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t != 3; ++t)
+    readers.push_back(std::thread([&s, &done, &errors, t]
+    {
+      unsigned last = 0;
+      while (!done.load())
+      {
+        if (!s.has_value())
+          continue;
+        optional<snapshot> const r = s.try_read();
+        if (!r)
+          continue;
+        if (!r->consistent() || r->fields[0] < last)
+          ++errors[t];
+        last = r->fields[0];
+      }
+    }));
+
+  for (unsigned v = 1; v != 20001; ++v)
+  {
+    if (v % 7 == 0)
+      s.reset();
+    else
+      s.store(snapshot(v));
+  }
+  done.store(true);
+  for (std::size_t t = 0; t != readers.size(); ++t)
+    readers[t].join();
+
+  for (int t = 0; t != 3; ++t)
+    BOOST_TEST_EQ(errors[t], 0);
+  BOOST_TEST_EQ(s.try_read()->fields[0], 20000u);
+}
+
+int main()
+{
+  test_single_thread();
+  test_concurrent_readers();
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
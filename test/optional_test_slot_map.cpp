@@ -0,0 +1,126 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/slot_map.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using boost::optional;
+
+typedef boost::slot_map<std::string> map_type;
+
+struct thrower
+{
+  int v;
+  explicit thrower(int v) : v(v) { if (v < 0) throw std::runtime_error("thrower"); }
+};
+
+void test_insert_erase()
+{
+  map_type m;
+  map_type::handle a = m.insert("a");
+  map_type::handle b = m.emplace(2, 'b');
+  BOOST_TEST_EQ(m.size(), 2u);
+  BOOST_TEST_EQ(*m.find(a), "a");
+  BOOST_TEST_EQ(*m.find(b), "bb");
+
+  BOOST_TEST(m.erase(a));
+  BOOST_TEST(!m.erase(a));
+  BOOST_TEST(!m.find(a));
+  BOOST_TEST_EQ(m.size(), 1u);
+
+  // the slot of `a` is reused, but the old handle stays invalid
+  map_type::handle c = m.insert("c");
+  BOOST_TEST_EQ(c.index, a.index);
+  BOOST_TEST(c != a);
+  BOOST_TEST(!m.find(a));
+  BOOST_TEST_EQ(*m.find(c), "c");
+  BOOST_TEST_EQ(m.capacity(), 2u);
+
+  *m.find(c) += "!";
+  map_type const& cm = m;
+  BOOST_TEST_EQ(*cm.find(c), "c!");
+}
+
+void test_free_list()
+{
+  map_type m;
+  std::vector<map_type::handle> hs;
+  for (int i = 0; i != 100; ++i)
+    hs.push_back(m.insert(std::to_string(i)));
+  for (int i = 0; i < 100; i += 2)
+    m.erase(hs[i]);
+  BOOST_TEST_EQ(m.size(), 50u);
+
+  for (int i = 0; i != 50; ++i)
+    m.insert("new");
+  BOOST_TEST_EQ(m.capacity(), 100u);
+  for (int i = 1; i < 100; i += 2)
+    BOOST_TEST_EQ(*m.find(hs[i]), std::to_string(i));
+
+  std::size_t n = 0;
+  m.for_each([&](map_type::handle h, std::string const& v) { ++n; BOOST_TEST_EQ(*m.find(h), v); });
+  BOOST_TEST_EQ(n, 100u);
+
+  map_type copy(m);
+  m.clear();
+  BOOST_TEST(m.empty());
+  BOOST_TEST(!m.find(hs[1]));
+  BOOST_TEST_EQ(*copy.find(hs[1]), "1");
+
+  m.insert("x");
+  BOOST_TEST_EQ(m.capacity(), 100u);
+  m = copy;
+  BOOST_TEST_EQ(m.size(), 100u);
+}
+
+void test_exception_safety()
+{
+  boost::slot_map<thrower> m;
+  boost::slot_map<thrower>::handle a = m.emplace(1);
+  m.emplace(2);
+  m.erase(a);
+
+  BOOST_TEST_THROWS(m.emplace(-1), std::runtime_error);
+  BOOST_TEST_EQ(m.size(), 1u);
+  boost::slot_map<thrower>::handle b = m.emplace(3);
+  BOOST_TEST_EQ(b.index, a.index);
+  boost::slot_map<thrower>::handle c = m.emplace(4);
+  BOOST_TEST_EQ(c.index, 2u);
+  BOOST_TEST_EQ(m.find(c)->v, 4);
+}
+
+void test_max_size()
+{
+  typedef boost::slot_map<int> map_type;
+  BOOST_TEST_EQ(map_type::max_size(), std::uint32_t(-1));
+
+  map_type m;
+  m.reserve(4);
+  BOOST_TEST(m.empty());
+  if (map_type::max_size() < (std::numeric_limits<std::size_t>::max)())
+    BOOST_TEST_THROWS(m.reserve(map_type::max_size() + 1), std::length_error);
+}
+
+int main()
+{
+  test_insert_erase();
+  test_free_list();
+  test_exception_safety();
+  test_max_size();
+
+  return boost::report_errors();
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/sparse_optional_array.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <string>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+std::vector<optional<int> > make_sparse(std::size_t n)
+{
+  std::vector<optional<int> > ans(n);
+  for (std::size_t i = 0; i < n; i += 97)
+    ans[i] = int(i);
+  for (std::size_t i = 1000; i < 1100 && i < n; ++i)
+    ans[i] = -int(i);
+  return ans;
+}
+
+void test_random_access()
+{
+  std::vector<optional<int> > dense = make_sparse(5000);
+  boost::sparse_optional_array<int> arr(dense.begin(), dense.end());
+
+  BOOST_TEST_EQ(arr.size(), dense.size());
+  std::size_t present = 0;
+  for (std::size_t i = 0; i != dense.size(); ++i)
+  {
+    BOOST_TEST_EQ(arr.rank(i), present);
+    BOOST_TEST_EQ(arr.has_value(i), bool(dense[i]));
+    BOOST_TEST_EQ(bool(arr[i]), bool(dense[i]));
+    if (dense[i])
+    {
+      BOOST_TEST_EQ(*arr[i], *dense[i]);
+      BOOST_TEST_EQ(arr.select(present), i);
+      ++present;
+    }
+  }
+  BOOST_TEST_EQ(arr.count(), present);
+  BOOST_TEST_EQ(arr.rank(arr.size()), present);
+}
+
+void test_iteration()
+{
+  std::vector<optional<int> > dense = make_sparse(3000);
+  boost::sparse_optional_array<int> arr(dense.begin(), dense.end());
+
+  std::vector<std::size_t> indices;
+  arr.for_each_present([&](std::size_t i, int const& v) {
+    BOOST_TEST(dense[i] == v);
+    indices.push_back(i);
+  });
+  BOOST_TEST_EQ(indices.size(), arr.count());
+
+  std::vector<std::size_t> via_next;
+  for (std::size_t i = arr.next_present(0); i != arr.size(); i = arr.next_present(i + 1))
+    via_next.push_back(i);
+  BOOST_TEST(via_next == indices);
+}
+
+void test_append()
+{
+  boost::sparse_optional_array<std::string> arr;
+  BOOST_TEST(arr.empty());
+  arr.push_back(none);
+  arr.append_none(1000);
+  arr.push_back(std::string("a"));
+  arr.emplace_back(3, 'b');
+  arr.push_back(optional<std::string>());
+  arr.push_back(optional<std::string>("c"));
+
+  BOOST_TEST_EQ(arr.size(), 1005u);
+  BOOST_TEST_EQ(arr.count(), 3u);
+  BOOST_TEST(!arr[1000]);
+  BOOST_TEST_EQ(*arr[1001], "a");
+  BOOST_TEST_EQ(*arr[1002], "bbb");
+  BOOST_TEST(!arr[1003]);
+  BOOST_TEST_EQ(*arr[1004], "c");
+  BOOST_TEST_EQ(arr.next_present(0), 1001u);
+  BOOST_TEST_EQ(arr.next_present(1005), 1005u);
+
+  boost::sparse_optional_array<std::string> other;
+  swap(arr, other);
+  BOOST_TEST(arr.empty());
+  BOOST_TEST_EQ(other.count(), 3u);
+  other.clear();
+  BOOST_TEST(other.empty());
+}
+
+int main()
+{
+  test_random_access();
+  test_iteration();
+  test_append();
+
+  return boost::report_errors();
+}
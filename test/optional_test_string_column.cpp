@@ -0,0 +1,101 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_string_column.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+void test_push_back()
+{
+  boost::optional_string_column col;
+  BOOST_TEST(col.empty());
+
+  col.push_back(std::string_view("alpha"));
+  col.push_back(none);
+  col.push_back(std::string_view(""));
+  col.push_back(optional<std::string_view>("beta"));
+  col.push_back(optional<std::string_view>());
+
+  BOOST_TEST_EQ(col.size(), 5u);
+  BOOST_TEST_EQ(col.count(), 3u);
+  BOOST_TEST_EQ(col.char_count(), 9u);
+
+  BOOST_TEST(col[0] == std::string_view("alpha"));
+  BOOST_TEST(!col[1]);
+  BOOST_TEST(col[2] == std::string_view(""));
+  BOOST_TEST(col[3] == std::string_view("beta"));
+  BOOST_TEST(col[4] == none);
+
+  BOOST_TEST_EQ(col.offsets()[3], 5u);
+  BOOST_TEST_EQ(col.offsets()[4], 9u);
+  BOOST_TEST_EQ(col.offsets()[5], 9u);
+}
+
+void test_bulk_append()
+{
+  std::vector<optional<std::string_view> > input;
+  for (int i = 0; i != 300; ++i)
+    input.push_back(i % 3 == 0 ? optional<std::string_view>() : optional<std::string_view>(std::string_view("xyz", std::size_t(i % 4))));
+
+  boost::optional_string_column col(input.begin(), input.end());
+  BOOST_TEST_EQ(col.size(), input.size());
+  for (std::size_t i = 0; i != input.size(); ++i)
+    BOOST_TEST(col[i] == input[i]);
+
+  std::vector<optional<std::string> > strings = { std::string("long string that would be heap-allocated"), none };
+  col.append(strings.begin(), strings.end());
+  BOOST_TEST_EQ(col.size(), 302u);
+  BOOST_TEST(col[300] == std::string_view(*strings[0]));
+  BOOST_TEST(!col[301]);
+
+  boost::optional_string_column other;
+  swap(col, other);
+  BOOST_TEST(col.empty());
+  BOOST_TEST_EQ(other.size(), 302u);
+  other.clear();
+  BOOST_TEST(other.empty());
+  BOOST_TEST_EQ(other.count(), 0u);
+}
+
+void test_wide()
+{
+  boost::optional_wstring_column col;
+  col.push_back(std::wstring_view(L"w"));
+  col.push_back(none);
+  BOOST_TEST(col[0] == std::wstring_view(L"w"));
+  BOOST_TEST(!col[1]);
+}
+
+int main()
+{
+  test_push_back();
+  test_bulk_append();
+  test_wide();
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
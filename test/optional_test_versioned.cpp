@@ -0,0 +1,180 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/versioned_optional.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using boost::optional;
+using boost::none;
+
+void test_generations()
+{
+  boost::versioned_optional<std::string> v;
+  BOOST_TEST_EQ(v.generation(), 0u);
+  BOOST_TEST(!v);
+  BOOST_TEST(!v.get());
+  BOOST_TEST_EQ(v.value_or("none"), "none");
+
+  std::uint64_t const g0 = v.generation();
+  BOOST_TEST(!v.changed_since(g0));
+
+  BOOST_TEST_EQ(v.emplace(3, 'a'), "aaa");
+  BOOST_TEST(v.changed_since(g0));
+  BOOST_TEST_EQ(v.generation(), 1u);
+  BOOST_TEST_EQ(*v, "aaa");
+  BOOST_TEST_EQ(v->size(), 3u);
+  BOOST_TEST_EQ(v.value(), "aaa");
+
+  v = std::string("b");
+  v = optional<std::string>("c");
+  v.reset();
+  BOOST_TEST_EQ(v.generation(), 4u);
+  v.reset();
+  v = none;
+  BOOST_TEST_EQ(v.generation(), 6u);
+
+  v = std::string("d");
+  v.modify([](std::string& s) { s += "e"; });
+  BOOST_TEST_EQ(*v, "de");
+  BOOST_TEST_EQ(v.generation(), 8u);
+
+  boost::versioned_optional<std::string> const w(boost::in_place_init, 2, 'x');
+  BOOST_TEST_EQ(*w, "xx");
+  BOOST_TEST_EQ(w.generation(), 0u);
+}
+
+void test_assign_versioned()
+{
+  boost::versioned_optional<int> a, b;
+  a.emplace(1);
+  b.emplace(42);
+  BOOST_TEST_EQ(a.generation(), b.generation());
+
+  std::uint64_t const g = a.generation();
+  a = b;
+  BOOST_TEST_EQ(*a, 42);
+  BOOST_TEST(a.changed_since(g));
+  BOOST_TEST_EQ(a.generation(), 2u);
+  BOOST_TEST_EQ(b.generation(), 1u);
+
+  boost::versioned_optional<int> c;
+  a.emplace(3);
+  a.emplace(4);
+  a = c;
+  BOOST_TEST(!a);
+  BOOST_TEST_EQ(a.generation(), 5u);
+
+  a = boost::versioned_optional<int>(7);
+  BOOST_TEST_EQ(*a, 7);
+  BOOST_TEST_EQ(a.generation(), 6u);
+
+  boost::versioned_optional<int> const d(a);
+  BOOST_TEST_EQ(*d, 7);
+  BOOST_TEST_EQ(d.generation(), 6u);
+}
+
+void test_update()
+{
+  boost::versioned_optional<int> v(1);
+  std::uint64_t const g = v.generation();
+
+  BOOST_TEST(!v.update(1));
+  BOOST_TEST(!v.changed_since(g));
+
+  BOOST_TEST(v.update(2));
+  BOOST_TEST(v.changed_since(g));
+  BOOST_TEST_EQ(*v, 2);
+
+  BOOST_TEST(v.update(none));
+  BOOST_TEST(!v);
+  std::uint64_t const g2 = v.generation();
+  BOOST_TEST(!v.update(none));
+  BOOST_TEST(!v.changed_since(g2));
+  BOOST_TEST(v.update(optional<int>(0)));
+  BOOST_TEST_EQ(v.generation(), g2 + 1);
+}
+
+// A node of an incremental computation: recomputes its value only if one
+// of its inputs has changed since the last computation.
+struct sum_node
+{
+  std::vector<boost::versioned_optional<int> const*> inputs;
+  std::vector<std::uint64_t> seen;
+  boost::versioned_optional<int> value;
+  int recomputations = 0;
+
+  void refresh()
+  {
+    bool stale = seen.size() != inputs.size();
+    for (std::size_t i = 0; !stale && i != inputs.size(); ++i)
+      stale = inputs[i]->changed_since(seen[i]);
+    if (!stale)
+      return;
+
+    ++recomputations;
+    seen.clear();
+    int s = 0;
+    for (std::size_t i = 0; i != inputs.size(); ++i)
+    {
+      seen.push_back(inputs[i]->generation());
+      s += inputs[i]->value_or(0);
+    }
+    value.update(s);
+  }
+};
+
+void test_incremental()
+{
+  boost::versioned_optional<int> a(1), b(2), c(3);
+  sum_node ab;
+  ab.inputs = { &a, &b };
+  sum_node abc;
+  abc.inputs = { &ab.value, &c };
+
+  ab.refresh();
+  abc.refresh();
+  BOOST_TEST_EQ(*abc.value, 6);
+
+  // an input recomputed to an equal value does not propagate
+  a.update(1);
+  ab.refresh();
+  abc.refresh();
+  BOOST_TEST_EQ(ab.recomputations, 1);
+  BOOST_TEST_EQ(abc.recomputations, 1);
+
+  // a change that leaves the sum unchanged stops at the first node
+  a = 2;
+  b = 1;
+  ab.refresh();
+  abc.refresh();
+  BOOST_TEST_EQ(ab.recomputations, 2);
+  BOOST_TEST_EQ(abc.recomputations, 1);
+
+  b.reset();
+  ab.refresh();
+  abc.refresh();
+  BOOST_TEST_EQ(abc.recomputations, 2);
+  BOOST_TEST_EQ(*abc.value, 5);
+}
+
+int main()
+{
+  test_generations();
+  test_assign_versioned();
+  test_update();
+  test_incremental();
+
+  return boost::report_errors();
+}
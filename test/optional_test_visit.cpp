@@ -0,0 +1,115 @@
+// Copyright (C) 2026 Andrzej Krzemienski.
+//
+// Use, modification, and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/lib/optional for documentation.
+//
+// You are welcome to contact the author at:
+//  akrzemi1@gmail.com
+
+#include "boost/optional/optional_visit.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <string>
+#include <tuple>
+
+using boost::optional;
+using boost::none;
+using boost::none_t;
+
+struct describe
+{
+  std::string operator()(int i, std::string const& s) const { return std::to_string(i) + s; }
+  std::string operator()(int i, none_t) const { return std::to_string(i) + "-"; }
+  std::string operator()(none_t, std::string const& s) const { return "-" + s; }
+  std::string operator()(none_t, none_t) const { return "--"; }
+};
+
+// Counts the present arguments and sums the integers among them.
+struct summarize
+{
+  int count;
+  int sum;
+
+  void add(int i) { ++count; sum += i; }
+  void add(long i) { ++count; sum += int(i); }
+  void add(none_t) {}
+
+  template <class A, class B, class C>
+  void operator()(A const& a, B const& b, C const& c) { add(a); add(b); add(c); }
+};
+
+struct increment
+{
+  int operator()(int& i) const { return ++i; }
+  int operator()(none_t) const { return 0; }
+};
+
+void test_visit()
+{
+  optional<int> i = 1;
+  optional<std::string> s = std::string("a");
+  optional<int> ni;
+  optional<std::string> ns;
+
+  BOOST_TEST_EQ(boost::optional_visit(describe(), i, s), "1a");
+  BOOST_TEST_EQ(boost::optional_visit(describe(), i, ns), "1-");
+  BOOST_TEST_EQ(boost::optional_visit(describe(), ni, s), "-a");
+  BOOST_TEST_EQ(boost::optional_visit(describe(), ni, ns), "--");
+
+  optional<int> const ci = 2;
+  BOOST_TEST_EQ(boost::optional_visit(describe(), ci, optional<std::string>("b")), "2b");
+}
+
+void test_all_combinations()
+{
+  for (int m = 0; m != 8; ++m)
+  {
+    optional<int> a = (m & 1) ? optional<int>(1) : optional<int>();
+    optional<long> b = (m & 2) ? optional<long>(10) : optional<long>();
+    optional<int> c = (m & 4) ? optional<int>(100) : optional<int>();
+
+    summarize s = { 0, 0 };
+    boost::optional_visit(s, a, b, c);
+    BOOST_TEST_EQ(s.count, ((m & 1) != 0) + ((m & 2) != 0) + ((m & 4) != 0));
+    BOOST_TEST_EQ(s.sum, (m & 1) * 1 + ((m & 2) ? 10 : 0) + ((m & 4) ? 100 : 0));
+  }
+}
+
+void test_visit_mutates()
+{
+  optional<int> i = 1;
+  BOOST_TEST_EQ(boost::optional_visit(increment(), i), 2);
+  BOOST_TEST_EQ(*i, 2);
+  i = none;
+  BOOST_TEST_EQ(boost::optional_visit(increment(), i), 0);
+}
+
+void test_zip()
+{
+  optional<int> i = 1;
+  optional<std::string> s = std::string("a");
+  optional<double> const d = 0.5;
+
+  optional<std::tuple<int&, std::string&, double const&> > z = boost::optional_zip(i, s, d);
+  BOOST_TEST(z);
+  std::get<0>(*z) = 5;
+  BOOST_TEST_EQ(*i, 5);
+  BOOST_TEST_EQ(&std::get<1>(*z), &*s);
+  BOOST_TEST_EQ(std::get<2>(*z), 0.5);
+
+  s = none;
+  BOOST_TEST(!boost::optional_zip(i, s, d));
+}
+
+int main()
+{
+  test_visit();
+  test_all_combinations();
+  test_visit_mutates();
+  test_zip();
+
+  return boost::report_errors();
+}